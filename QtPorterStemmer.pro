@@ -11,14 +11,23 @@ greaterThan(QT_MAJOR_VERSION, 4): QT += widgets
 TARGET = QtPorterStemmer
 TEMPLATE = app
 
+include(stemmer.pri)
 
 SOURCES += main.cpp\
+        filestemmer.cpp \
         mainwindow.cpp \
-    enporterstemmer.cpp \
-    lvporterstemmer.cpp
+        stemprofiler.cpp
 
-HEADERS  += mainwindow.h \
-    enporterstemmer.h \
-    lvporterstemmer.h
+HEADERS  += filestemmer.h \
+        mainwindow.h \
+        stemprofiler.h
 
 FORMS    += mainwindow.ui
+
+# qmake CONFIG+=profile_allocations counts heap allocations on the
+# Profile tab by replacing malloc() and its kin for the whole process
+profile_allocations {
+    DEFINES += PROFILE_ALLOCATIONS
+    SOURCES += bench/allocationcount.cpp
+    HEADERS += bench/allocationcount.h
+}
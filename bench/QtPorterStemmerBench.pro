@@ -0,0 +1,21 @@
+#-------------------------------------------------
+#
+# Stemmer benchmark, prints JSON
+#
+#-------------------------------------------------
+
+QT       += core
+QT       -= gui
+
+TARGET = QtPorterStemmerBench
+CONFIG   += console
+CONFIG   -= app_bundle
+TEMPLATE = app
+
+include(../stemmer.pri)
+
+SOURCES += main.cpp \
+    allocationcount.cpp
+
+HEADERS  += allocationcount.h \
+    wordlists.h
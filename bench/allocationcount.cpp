@@ -0,0 +1,142 @@
+/******************************************************************
+
+   Per thread heap allocation counter for the benchmark and the
+   profiler.
+
+   Licensed under GPLv3. See LICENCE.md file
+
+**/
+
+#include "allocationcount.h"
+
+#include <errno.h>
+#include <new>
+#include <stdlib.h>
+
+/* Constant initialized, malloc() runs before any constructor does.  It
+   lives in the executable's static TLS block, so reaching it from
+   malloc() never allocates itself */
+static thread_local quint64 allocations = 0;
+
+#if defined(__GLIBC__)
+
+/* glibc exports its allocator under these names too, so defining malloc()
+   here interposes every malloc() in the process, QString's included.
+   glibc asks that a replacement covers free() and the aligned
+   allocators as well, so they are all here and all forward to glibc's
+   own; malloc_usable_size() is left to glibc, the memory is its */
+extern "C" {
+
+void *__libc_malloc(size_t size);
+void *__libc_calloc(size_t count, size_t size);
+void *__libc_realloc(void *pointer, size_t size);
+void __libc_free(void *pointer);
+void *__libc_memalign(size_t alignment, size_t size);
+void *__libc_valloc(size_t size);
+void *__libc_pvalloc(size_t size);
+
+void *malloc(size_t size)
+{
+    allocations++;
+    return __libc_malloc( size );
+}
+
+void *calloc(size_t count, size_t size)
+{
+    allocations++;
+    return __libc_calloc( count, size );
+}
+
+void *realloc(void *pointer, size_t size)
+{
+    allocations++;
+    return __libc_realloc( pointer, size );
+}
+
+void free(void *pointer)
+{
+    __libc_free( pointer );
+}
+
+void *memalign(size_t alignment, size_t size)
+{
+    allocations++;
+    return __libc_memalign( alignment, size );
+}
+
+void *aligned_alloc(size_t alignment, size_t size)
+{
+    allocations++;
+    return __libc_memalign( alignment, size );
+}
+
+int posix_memalign(void **pointer, size_t alignment, size_t size)
+{
+    if(0 == alignment || 0 != (alignment & (alignment - 1)) || 0 != alignment % sizeof(void *))
+        return EINVAL;
+
+    allocations++;
+    void *block = __libc_memalign( alignment, size );
+    if(NULL == block)
+        return ENOMEM;
+
+    *pointer = block;
+    return 0;
+}
+
+void *valloc(size_t size)
+{
+    allocations++;
+    return __libc_valloc( size );
+}
+
+void *pvalloc(size_t size)
+{
+    allocations++;
+    return __libc_pvalloc( size );
+}
+
+}
+
+bool AllocationCountComplete()
+{
+    return true;
+}
+
+#else
+
+void *operator new(size_t size)
+{
+    allocations++;
+    void *pointer = malloc( size ? size : 1 );
+    if(!pointer)
+        throw std::bad_alloc();
+    return pointer;
+}
+
+void *operator new[](size_t size)
+{
+    return operator new( size );
+}
+
+void operator delete(void *pointer) Q_DECL_NOTHROW
+{
+    free( pointer );
+}
+
+void operator delete[](void *pointer) Q_DECL_NOTHROW
+{
+    free( pointer );
+}
+
+bool AllocationCountComplete()
+{
+    return false;
+}
+
+#endif
+
+quint64 AllocationCount()
+{
+    return allocations;
+}
@@ -0,0 +1,23 @@
+/******************************************************************
+
+   Per thread heap allocation counter for the benchmark and the
+   profiler.
+
+   Licensed under GPLv3. See LICENCE.md file
+
+**/
+
+#ifndef ALLOCATIONCOUNT_H
+#define ALLOCATIONCOUNT_H
+
+#include <QtGlobal>
+
+// Number of heap allocations made so far by the calling thread, so
+// what other threads allocate meanwhile does not count.
+quint64 AllocationCount();
+
+// False where only operator new can be counted, so allocations made by
+// Qt containers through malloc() are missing from AllocationCount().
+bool AllocationCountComplete();
+
+#endif // ALLOCATIONCOUNT_H
@@ -0,0 +1,274 @@
+/******************************************************************
+
+   Benchmark: ns/word, words/sec and allocations/word of both stemmers,
+   per step and end to end, over fixed word lists. Prints JSON.
+
+   Licensed under GPLv3. See LICENCE.md file
+
+**/
+
+#include <QCoreApplication>
+#include <QCommandLineParser>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QVector>
+
+#include <stdio.h>
+#include <string.h>
+
+#include "allocationcount.h"
+#include "enporterstemmer.h"
+#include "lvporterstemmer.h"
+#include "wordlists.h"
+
+/* Format of the JSON, bump when fields change meaning */
+#define BENCH_FORMAT  1
+
+/* Pass modes besides 0..stepCount(), the number of steps to run */
+#define PASS_COPY     -1           /* only copy the words, the baseline */
+#define PASS_QSTRING  -2           /* stem(QString) */
+
+typedef struct {
+           const char *name;                       /* "en" or "lv" */
+           QString (*stemString)(QString word);
+           int (*stemSteps)(QChar *word, int length, int steps);
+           int (*stepCount)();
+           const char *(*stepName)(int step);
+           const WordList *lists;
+           } Stemmer;
+
+typedef struct {
+           QVector<QChar> text;            /* every word back to back */
+           QVector<int> offsets;           /* word i is text[offsets[i]..offsets[i+1]) */
+           QVector<QString> strings;       /* the same words as QStrings */
+           int repeat;                     /* passes per timed run */
+           } Input;
+
+typedef struct {
+           double nsPerWord;               /* best of the runs */
+           double allocationsPerWord;
+           } Timing;
+
+static const Stemmer stemmers[] =
+           {
+             {"en", ENPorterStemmer::stem, ENPorterStemmer::stemSteps,
+              ENPorterStemmer::stepCount, ENPorterStemmer::stepName, en_word_lists},
+             {"lv", LVPorterStemmer::stem, LVPorterStemmer::stemSteps,
+              LVPorterStemmer::stepCount, LVPorterStemmer::stepName, lv_word_lists},
+           };
+
+/* Keeps the compiler from dropping the stemming as dead code */
+static volatile quint64 sink;
+
+static Input MakeInput(const WordList &list, int minWords)
+{
+    Input input;
+
+    input.offsets.append( 0 );
+    for(int i=0; list.words[i]; i++)
+    {
+        QString word = QString::fromUtf8( list.words[i] );
+        input.strings.append( word );
+        for(int j=0; j<word.length(); j++)
+            input.text.append( word.at(j) );
+        input.offsets.append( input.text.size() );
+    }
+
+    input.repeat = (minWords + input.strings.size() - 1) / input.strings.size();
+
+    return input;
+}
+
+/*FN**************************************************************************
+
+       RunPass( input, stemmer, mode, scratch )
+
+   Returns: quint64 -- a checksum of the stems
+
+   Purpose: Stem every word of input once the way mode says.  The buffer
+            modes copy each word into scratch first since stemming works
+            in place; PASS_COPY times that copy alone.
+**/
+
+static quint64 RunPass(const Input &input, const Stemmer &stemmer, int mode, QChar *scratch)
+{
+    quint64 checksum = 0;
+    int count = input.strings.size();
+
+    if(PASS_QSTRING == mode)
+    {
+        for(int i=0; i<count; i++)
+            checksum += stemmer.stemString( input.strings.at(i) ).length();
+        return checksum;
+    }
+
+    for(int i=0; i<count; i++)
+    {
+        int length = input.offsets.at(i + 1) - input.offsets.at(i);
+        memcpy( scratch, input.text.constData() + input.offsets.at(i), length * sizeof(QChar) );
+        if(PASS_COPY != mode)
+            length = stemmer.stemSteps( scratch, length, mode );
+        checksum += length + (length > 0 ? scratch[length - 1].unicode() : 0);
+    }
+
+    return checksum;
+}
+
+static Timing Measure(const Input &input, const Stemmer &stemmer, int mode, int runs)
+{
+    QVector<QChar> scratch( input.text.size() + 1 );
+    quint64 words = quint64(input.strings.size()) * input.repeat;
+    Timing timing;
+
+    sink += RunPass( input, stemmer, mode, scratch.data() );      /* warm up */
+
+    timing.nsPerWord = -1;
+    for(int run=0; run<runs; run++)
+    {
+        quint64 checksum = 0;
+        quint64 allocations = AllocationCount();
+        QElapsedTimer timer;
+
+        timer.start();
+        for(int r=0; r<input.repeat; r++)
+            checksum += RunPass( input, stemmer, mode, scratch.data() );
+        qint64 nsecs = timer.nsecsElapsed();
+
+        timing.allocationsPerWord = double(AllocationCount() - allocations) / words;
+        if(timing.nsPerWord < 0 || double(nsecs) / words < timing.nsPerWord)
+            timing.nsPerWord = double(nsecs) / words;
+        sink += checksum;
+    }
+
+    return timing;
+}
+
+static QJsonObject Metrics(double nsPerWord, double allocationsPerWord, bool throughput)
+{
+    QJsonObject metrics;
+
+    metrics["ns_per_word"] = nsPerWord;
+    if(throughput)
+        metrics["words_per_sec"] = nsPerWord > 0 ? 1e9 / nsPerWord : 0.0;
+    metrics["allocations_per_word"] = allocationsPerWord;
+
+    return metrics;
+}
+
+/*FN**************************************************************************
+
+       BenchList( stemmer, list, minWords, runs )
+
+   Returns: QJsonObject -- the results for one stemmer over one list
+
+   Plan:    Time the word copy alone, then stemSteps() with 0, 1, ...
+            stepCount() steps.  Each step costs the difference between
+            two neighbouring prefixes, step 0 being the lowering and the
+            set up.  The buffer end to end figure is the full run less
+            the copy; stem(QString) is timed as is.
+**/
+
+static QJsonObject BenchList(const Stemmer &stemmer, const WordList &list, int minWords, int runs)
+{
+    Input input = MakeInput( list, minWords );
+    int count = stemmer.stepCount();
+
+    Timing copy = Measure( input, stemmer, PASS_COPY, runs );
+    Timing qstring = Measure( input, stemmer, PASS_QSTRING, runs );
+
+    QJsonArray steps;
+    Timing previous = copy;
+    for(int step=0; step<=count; step++)
+    {
+        Timing prefix = Measure( input, stemmer, step, runs );
+        QJsonObject metrics = Metrics( prefix.nsPerWord - previous.nsPerWord,
+                                       prefix.allocationsPerWord - previous.allocationsPerWord, false );
+        metrics["step"] = step ? QString( stemmer.stepName( step - 1 ) ) : QString( "lower" );
+        steps.append( metrics );
+        previous = prefix;
+    }
+
+    QJsonObject endToEnd;
+    endToEnd["qstring"] = Metrics( qstring.nsPerWord, qstring.allocationsPerWord, true );
+    endToEnd["buffer"] = Metrics( previous.nsPerWord - copy.nsPerWord,
+                                  previous.allocationsPerWord - copy.allocationsPerWord, true );
+
+    QJsonObject result;
+    result["stemmer"] = QString( stemmer.name );
+    result["input"] = QString( list.name );
+    result["words"] = input.strings.size();
+    result["repeat"] = input.repeat;
+    result["copy_ns_per_word"] = copy.nsPerWord;
+    result["end_to_end"] = endToEnd;
+    result["steps"] = steps;
+
+    return result;
+}
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication a(argc, argv);
+    QCoreApplication::setApplicationName( "QtPorterStemmerBench" );
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription( "Benchmarks both stemmers over fixed word lists and prints JSON." );
+    parser.addHelpOption();
+    QCommandLineOption langOption( QStringList() << "l" << "lang", "Stemmer to run, lv, en or all (default all).", "lang", "all" );
+    QCommandLineOption runsOption( QStringList() << "r" << "runs", "Timed runs per figure, the best is kept (default 5).", "n", "5" );
+    QCommandLineOption wordsOption( QStringList() << "n" << "words", "Words stemmed per timed run (default 200000).", "n", "200000" );
+    QCommandLineOption outputOption( QStringList() << "o" << "output", "Write the JSON to a file instead of stdout.", "file" );
+    parser.addOption( langOption );
+    parser.addOption( runsOption );
+    parser.addOption( wordsOption );
+    parser.addOption( outputOption );
+    parser.process( a );
+
+    QString lang = parser.value( langOption );
+    if(lang != "all" && lang != "en" && lang != "lv")
+    {
+        fprintf( stderr, "Unknown language %s\n", qPrintable(lang) );
+        return 1;
+    }
+
+    int runs = qMax( 1, parser.value( runsOption ).toInt() );
+    int minWords = qMax( 1, parser.value( wordsOption ).toInt() );
+
+    QJsonArray results;
+    for(int i=0; i<int(sizeof(stemmers) / sizeof(stemmers[0])); i++)
+    {
+        if(lang != "all" && lang != stemmers[i].name)
+            continue;
+        for(int j=0; stemmers[i].lists[j].name; j++)
+            results.append( BenchList( stemmers[i], stemmers[i].lists[j], minWords, runs ) );
+    }
+
+    QJsonObject report;
+    report["benchmark"] = QString( "QtPorterStemmerBench" );
+    report["format"] = BENCH_FORMAT;
+    report["qt"] = QString( qVersion() );
+    report["runs"] = runs;
+    report["min_words"] = minWords;
+    report["allocations_complete"] = AllocationCountComplete();
+    report["results"] = results;
+
+    QFile out;
+    bool opened;
+    if(parser.isSet( outputOption ))
+    {
+        out.setFileName( parser.value( outputOption ) );
+        opened = out.open( QIODevice::WriteOnly | QIODevice::Truncate );
+    }
+    else
+        opened = out.open( stdout, QIODevice::WriteOnly );
+
+    if(!opened || out.write( QJsonDocument( report ).toJson() ) < 0)
+    {
+        fprintf( stderr, "%s\n", qPrintable(out.errorString()) );
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,196 @@
+/******************************************************************
+
+   Fixed benchmark inputs. The lists must not change between releases
+   or the numbers stop being comparable; add a new list instead.
+
+   Licensed under GPLv3. See LICENCE.md file
+
+**/
+
+#ifndef WORDLISTS_H
+#define WORDLISTS_H
+
+typedef struct {
+           const char *name;               /* input name in the JSON */
+           const char *const *words;       /* UTF-8, NULL terminated */
+           } WordList;
+
+/*****************************************************************************/
+/*******************************   English   *********************************/
+
+static const char *const en_short_words[] =
+           {
+             "a", "an", "as", "at", "be", "by", "do", "go", "he", "if",
+             "in", "is", "it", "me", "my", "no", "of", "on", "or", "so",
+             "to", "up", "us", "we", "cat", "dog", "run", "sat", "bed", "car",
+             "sky", "ties", "bus", "was", "has", "his", "its", "yes", "buy", "fly",
+             "try", "cry", "dry", "sees", "goes", "runs", "eats", "ran", "red", "sad",
+             "big", "add", "egg", "ill", "off", "odd", "all", "own", "see", "too",
+             "two", "new", "old", "end", "era", "eye", "fed", "bled", "sing", "rate",
+             "roll", "cats", "feed", "ate", "ice", "pony", "toy", "days", "men", "hat",
+             "sun", "sea", "box", "fox", "key", "law", "map", "net", "oak", "pen",
+             "rug", "tea", "van", "web", "zoo", "jobs", "kind", "lies", "mind", "news",
+             NULL
+           };
+
+static const char *const en_typical_words[] =
+           {
+             "running", "connected", "connection", "agreement", "happiness",
+             "relational", "conditional", "rational", "valency", "digitizer",
+             "conformable", "radically", "differently", "vilely", "analogously",
+             "predication", "operator", "feudalism", "decisiveness", "hopefulness",
+             "callousness", "formality", "sensitivity", "sensibility", "triplicate",
+             "formative", "formalize", "electricity", "electrical", "hopeful",
+             "goodness", "revival", "allowance", "inference", "airliner",
+             "gyroscopic", "adjustable", "defensible", "irritant", "replacement",
+             "adjustment", "dependent", "adoption", "communism", "activate",
+             "angularity", "homologous", "effective", "bowdlerize", "probate",
+             "cease", "controlled", "caresses", "ponies", "caress",
+             "agreed", "plastered", "motoring", "conflated", "troubled",
+             "sized", "hopping", "tanned", "falling", "hissing",
+             "fizzed", "failing", "filing", "happy", "national",
+             "government", "development", "information", "children", "important",
+             "community", "university", "following", "including", "political",
+             "interesting", "believed", "questions", "described", "reported",
+             "working", "students", "houses", "played", "teaching",
+             "computers", "programming", "processing", "generally", "organized",
+             "traditional", "searching", "stemming", "languages", "algorithms",
+             NULL
+           };
+
+static const char *const en_long_words[] =
+           {
+             "internationalization", "institutionalization", "counterrevolutionaries",
+             "responsibilities", "characterization", "misunderstandings",
+             "telecommunications", "incomprehensibility", "disproportionately",
+             "electroencephalography", "uncharacteristically", "interdisciplinary",
+             "professionalization", "compartmentalization", "deinstitutionalization",
+             "overgeneralization", "representativeness", "antidisestablishmentarianism",
+             "conceptualizations", "industrialization", "administratively",
+             "experimentations", "photosynthesizing", "environmentalists",
+             "acknowledgements", "congratulations", "disqualifications",
+             "individualistic", "nationalistically", "transformational",
+             "unconditionally", "hypersensitivity", "reconsiderations",
+             "unsustainability", "multiculturalism", "intercontinental",
+             "electromagnetism", "psychotherapeutic", "interchangeability",
+             "commercialization", "decentralization", "irreconcilability",
+             "miscommunications", "oversimplification", "counterproductively",
+             "indistinguishable", "unquestionableness", "establishmentarian",
+             "disenfranchisement", "contradistinction",
+             NULL
+           };
+
+static const char *const en_stop_words[] =
+           {
+             "the", "of", "and", "to", "in", "is", "that", "it", "was", "for",
+             "on", "are", "as", "with", "his", "they", "at", "be", "this", "from",
+             "have", "or", "by", "one", "had", "not", "but", "what", "all", "were",
+             "when", "we", "there", "can", "an", "your", "which", "their", "said", "if",
+             "do", "will", "each", "about", "how", "up", "out", "them", "then", "she",
+             "many", "some", "so", "these", "would", "other", "into", "has", "more", "her",
+             "two", "like", "him", "see", "time", "could", "no", "make", "than", "first",
+             "been", "its", "who", "now", "people", "my", "made", "over", "did", "down",
+             "only", "way", "find", "use", "may", "water", "long", "little", "very", "after",
+             "words", "called", "just", "where", "most", "know", "the", "and", "of", "the",
+             NULL
+           };
+
+static const WordList en_word_lists[] =
+           {
+             {"short",     en_short_words},
+             {"typical",   en_typical_words},
+             {"long",      en_long_words},
+             {"stopwords", en_stop_words},
+             {NULL,        NULL},
+           };
+
+/*****************************************************************************/
+/*******************************   Latvian   *********************************/
+
+static const char *const lv_short_words[] =
+           {
+             "es", "tu", "mēs", "jūs", "viņš", "kas", "kur", "šī", "jā", "nē",
+             "suns", "kaķis", "māja", "roka", "galds", "zeme", "diena", "nakts", "laiks", "gads",
+             "ceļš", "vējš", "zivs", "sals", "lapa", "pils", "koks", "upe", "jūra", "ezers",
+             "saule", "sniegs", "acis", "ausis", "kāja", "galva", "maize", "piens", "sāls", "medus",
+             "lauks", "mežs", "kalns", "sēta", "durvis", "logs", "siena", "jumts", "krēsls", "gulta",
+             "vīrs", "sieva", "dēls", "meita", "tēvs", "māte", "brālis", "māsa", "draugs", "kungs",
+             "zaļš", "balts", "melns", "sarkans", "zils", "liels", "mazs", "jauns", "vecs", "labs",
+             "iet", "nāk", "ēd", "dzer", "guļ", "sēž", "stāv", "lasa", "raksta", "runā",
+             "vārds", "skaņa", "gaisma", "ēna", "uguns", "ledus", "vilks", "lācis", "putns", "zirgs",
+             "ābols", "bumba", "cepure", "zeķe", "kurpe", "soma", "nauda", "cena", "darbs", "rīts",
+             NULL
+           };
+
+static const char *const lv_typical_words[] =
+           {
+             "valsts", "valodas", "skolotājs", "grāmatas", "mājās",
+             "pilsētā", "iedzīvotāji", "darbinieki", "universitāte", "studentiem",
+             "sabiedrības", "attīstība", "valdības", "likumprojekts", "pašvaldības",
+             "uzņēmumiem", "ekonomikas", "informācijas", "tehnoloģijas", "programmēšana",
+             "dzīvoja", "strādāja", "runāja", "rakstīja", "lasīja",
+             "redzēja", "gribēja", "domāju", "mācījās", "ceļojumu",
+             "vārdiem", "teikumiem", "jautājumi", "atbildes", "skaistākā",
+             "lielākais", "mazākie", "vecākiem", "bērniem", "draugiem",
+             "ģimenes", "brīvdienas", "svētkiem", "dziesmas", "dejotāji",
+             "māksliniece", "rakstnieks", "dzejnieka", "vēsturē", "nākotnē",
+             "pagātnē", "tagadnē", "laikapstākļi", "mežā", "laukos",
+             "kalnos", "ezeros", "upēs", "jūrā", "pludmalē",
+             "reliģija", "reliģijas", "cilvēki", "cilvēkiem", "sievietes",
+             "vīriešiem", "darbā", "skolās", "slimnīcā", "ārstiem",
+             "zinātne", "zinātnieki", "pētījumi", "rezultātiem", "mērķis",
+             "problēmas", "risinājumu", "iespējas", "vajadzības", "lēmumu",
+             "sanāksmē", "priekšsēdētājs", "deputāti", "vēlēšanās", "partijas",
+             "ziņas", "laikrakstā", "televīzijā", "internetā", "datoriem",
+             "mūzika", "koncertā", "izrādes", "teātrī", "filmām",
+             "sportisti", "sacensībās", "uzvarēja", "zaudēja", "spēlēja",
+             NULL
+           };
+
+static const char *const lv_long_words[] =
+           {
+             "neatkarīgākajiem", "visinteresantākajām", "starptautiskajās",
+             "ekonomiskākajiem", "nacionālsociālisms", "elektroenerģētika",
+             "tautsaimniecības", "līdzdarbošanās", "vispārizglītojošās",
+             "apdrošināšanas", "ieinteresētajām", "atjaunojamajiem",
+             "pārstrukturizācija", "uzņēmējdarbības", "informācijtehnoloģijām",
+             "nekustamajiem", "zinātniskajiem", "profesionālākajiem",
+             "administratīvajām", "reģionālajām", "mazaizsargātajiem",
+             "sadarbībspējīgākajiem", "neapmierinātība", "pašvaldībām",
+             "visneapdomīgākajiem", "priekšsēdētājiem", "līdzatbildīgajām",
+             "pretterorisma", "dabaszinātnieku", "vēstniecībām",
+             "kvalifikācijām", "apmierinātākajiem", "internacionalizācija",
+             "elektrotehnikas", "vispārcilvēciskām", "lauksaimniecībā",
+             "ārpusskolas", "mežsaimniecības", "komunikācijspējas",
+             "nepārprotamākajiem", "grāmatvedībām", "konkurētspējīgākās",
+             "piesardzīgākajiem", "neprognozējamākajiem", "organizatoriskajām",
+             "pašapliecināšanās", "valodniecībai", "transportlīdzekļiem",
+             "savstarpējiem", "tiesībsargājošās",
+             NULL
+           };
+
+static const char *const lv_stop_words[] =
+           {
+             "un", "bet", "jo", "ja", "ka", "lai", "tomēr", "tikko", "turpretī", "arī",
+             "kaut", "gan", "tādēļ", "tā", "ne", "tikvien", "vien", "kā", "ir", "te",
+             "vai", "kamēr", "aiz", "ap", "ar", "apakš", "ārpus", "bez", "caur", "dēļ",
+             "gar", "iekš", "iz", "kopš", "labad", "līdz", "no", "pa", "par", "pār",
+             "pēc", "pie", "pirms", "pret", "priekš", "starp", "uz", "virs", "zem", "pat",
+             "es", "viņš", "māja", "un", "ir", "valsts", "ar", "uz", "darbs", "un",
+             "ka", "lai", "skolā", "bet", "arī", "pēc", "gadā", "par", "no", "un",
+             "ir", "tā", "pie", "jo", "cilvēki", "kā", "ja", "vai", "ne", "un",
+             "taču", "nu", "ik", "it", "ar", "diezin", "apakšpus", "kamēr", "vien", "te",
+             "laiks", "un", "bez", "līdz", "pret", "starp", "ir", "zem", "virs", "un",
+             NULL
+           };
+
+static const WordList lv_word_lists[] =
+           {
+             {"short",     lv_short_words},
+             {"typical",   lv_typical_words},
+             {"long",      lv_long_words},
+             {"stopwords", lv_stop_words},
+             {NULL,        NULL},
+           };
+
+#endif // WORDLISTS_H
@@ -0,0 +1,17 @@
+#-------------------------------------------------
+#
+# Headless command line stemmer, no QtWidgets
+#
+#-------------------------------------------------
+
+QT       += core
+QT       -= gui
+
+TARGET = QtPorterStemmerCli
+CONFIG   += console
+CONFIG   -= app_bundle
+TEMPLATE = app
+
+include(../stemmer.pri)
+
+SOURCES += main.cpp
@@ -0,0 +1,398 @@
+/******************************************************************
+
+   Headless stemmer: streams whitespace separated tokens from files or
+   stdin to stdout, one stem per line, or counts stem frequencies over
+   memory mapped files.
+
+   Licensed under GPLv3. See LICENCE.md file
+
+**/
+
+#include <QCoreApplication>
+#include <QCommandLineParser>
+#include <QFile>
+#include <QThread>
+#include <QVarLengthArray>
+#include <QVector>
+#include <QtConcurrent>
+
+#include <stdio.h>
+#include <string.h>
+
+#include "enporterstemmer.h"
+#include "lvporterstemmer.h"
+#include "ruleautomaton.h"
+#include "stemdictionary.h"
+#include "termfrequency.h"
+#include "utf8text.h"
+
+enum LANG_SELECT {LANG_LV, LANG_EN};
+
+/* Bytes read from the input per round, split between the threads */
+#define READ_BLOCK (4 * 1024 * 1024)
+
+#define IsSpace(c)  (' '==(c)||'\n'==(c)||'\t'==(c)||'\r'==(c)||'\f'==(c)||'\v'==(c))
+
+typedef struct {
+           const char *begin;      /* first byte of the slice */
+           const char *end;        /* one past the last byte */
+           LANG_SELECT lang;
+           const RuleAutomaton *rules; /* stems with these when not NULL */
+           const StemDictionary *dictionary; /* consulted first when not NULL */
+           QByteArray out;         /* stems, one per line */
+           } Slice;
+
+/*FN**************************************************************************
+
+       StemToken( token, length, slice, out )
+
+   Purpose: Append the stem of one UTF-8 token and a newline to out.
+
+   Notes:   A dictionary answers from the raw bytes.  English goes through the byte entry point of ENPorterStemmer.
+            Latvian tokens and tokens for a loaded rule set are decoded
+            into a stack buffer and stemmed in place, so no path builds a
+            QString.
+**/
+
+static void StemToken(const char *token, int length, const Slice &slice, QByteArray &out)
+{
+    int pos = out.size();
+    const RuleAutomaton *rules = slice.rules;
+
+    if(NULL != slice.dictionary)
+    {
+        int capacity = length + 16;
+        out.resize( pos + capacity );
+        int size = slice.dictionary->find( token, length, out.data() + pos, capacity );
+        if(size > capacity)
+        {
+            out.resize( pos + size );
+            slice.dictionary->find( token, length, out.data() + pos, size );
+        }
+        if(size >= 0)
+        {
+            out.resize( pos + size );
+            out.append( '\n' );
+            return;
+        }
+        out.resize( pos );
+    }
+
+    if(NULL != rules)
+    {
+        QVarLengthArray<QChar, 128> word( rules->maxStemLength( length ) );
+        int size = Utf8ToUtf16( token, length, word.data() );
+        size = rules->stem( word.data(), size, word.size() );
+        out.resize( pos + 3 * size );
+        out.resize( pos + Utf16ToUtf8( word.data(), size, out.data() + pos ) );
+    }
+    else if(LANG_EN == slice.lang)
+    {
+        int capacity = 3 * length;
+        out.resize( pos + capacity );
+        int size = ENPorterStemmer::stem( token, length, out.data() + pos, capacity );
+        if(size > capacity)
+        {
+            out.resize( pos + size );
+            ENPorterStemmer::stem( token, length, out.data() + pos, size );
+        }
+        out.resize( pos + size );
+    }
+    else
+    {
+        QVarLengthArray<QChar, 128> word( length );
+        int size = Utf8ToUtf16( token, length, word.data() );
+        size = LVPorterStemmer::stem( word.data(), size );
+        out.resize( pos + 3 * size );
+        out.resize( pos + Utf16ToUtf8( word.data(), size, out.data() + pos ) );
+    }
+
+    out.append( '\n' );
+}
+
+static void StemSlice(Slice &slice)
+{
+    const char *p = slice.begin;
+
+    slice.out.clear();
+    slice.out.reserve( int(slice.end - slice.begin) + 1024 );
+    while(p < slice.end)
+    {
+        while(p < slice.end && IsSpace(*p))
+            p++;
+
+        const char *token = p;
+        while(p < slice.end && !IsSpace(*p))
+            p++;
+
+        if(p > token)
+            StemToken( token, int(p - token), slice, slice.out );
+    }
+}
+
+/*FN**************************************************************************
+
+       StemStream( in, out, lang, rules, dictionary, threads )
+
+   Returns: bool -- false if reading or writing failed
+
+   Plan:    Read big blocks, keep back a token cut by the end of a block
+            for the next round, split the rest at whitespace into one
+            slice per thread and write the slices out in order.
+**/
+
+static bool StemStream(QFile &in, QFile &out, LANG_SELECT lang, const RuleAutomaton *rules,
+                       const StemDictionary *dictionary, int threads)
+{
+    QByteArray block;
+    int carried = 0;
+    QVector<Slice> slices( threads );
+
+    for(;;)
+    {
+        block.resize( carried + READ_BLOCK );
+        qint64 got = in.read( block.data() + carried, READ_BLOCK );
+        if(got < 0)
+            return false;
+
+        int size = carried + int(got);
+        int cut = size;
+        if(got > 0)
+        {
+            while(cut > 0 && !IsSpace(block.at(cut - 1)))
+                cut--;
+            if(0 == cut)
+                cut = size;    /* one huge token, stem what there is */
+        }
+
+        const char *begin = block.constData();
+        const char *end = begin + cut;
+        for(int i=0; i<threads; i++)
+        {
+            const char *sliceEnd = (i == threads - 1) ? end : begin + (end - begin) / (threads - i);
+            while(sliceEnd < end && !IsSpace(*sliceEnd))
+                sliceEnd++;
+            slices[i].begin = begin;
+            slices[i].end = sliceEnd;
+            slices[i].lang = lang;
+            slices[i].rules = rules;
+            slices[i].dictionary = dictionary;
+            begin = sliceEnd;
+        }
+
+        if(threads > 1)
+            QtConcurrent::blockingMap( slices, StemSlice );
+        else
+            StemSlice( slices[0] );
+
+        for(int i=0; i<threads; i++)
+        {
+            if(out.write( slices.at(i).out ) != slices.at(i).out.size())
+                return false;
+        }
+
+        carried = size - cut;
+        memmove( block.data(), block.constData() + cut, carried );
+
+        if(0 == got)
+            return true;
+    }
+}
+
+/*FN**************************************************************************
+
+       CountFiles( files, out, lang, threads )
+
+   Returns: int -- process exit code
+
+   Purpose: Write "count<TAB>stem" lines for every stem in the files, most
+            frequent first.
+**/
+
+static int CountFiles(const QStringList &files, QFile &out, LANG_SELECT lang, int threads)
+{
+    TermFrequency::StemFunction stemFunction = LVPorterStemmer::stem;
+    if(LANG_EN == lang)
+        stemFunction = ENPorterStemmer::stem;
+
+    TermFrequency frequency( stemFunction, threads );
+    int result = 0;
+
+    foreach(const QString &name, files)
+    {
+        if(!frequency.addFile( name ))
+        {
+            fprintf( stderr, "%s\n", qPrintable(frequency.errorString()) );
+            result = 1;
+        }
+    }
+
+    QVector<TermCount> table = frequency.table();
+    for(int i=0; i<table.size(); i++)
+    {
+        QByteArray line = QByteArray::number( table.at(i).count ) + '\t' + table.at(i).stem.toUtf8() + '\n';
+        if(out.write( line ) != line.size())
+            return 1;
+    }
+
+    return result;
+}
+
+/*FN**************************************************************************
+
+       WriteRuleStats( name, lang )
+
+   Returns: bool -- false if the file could not be written
+
+   Purpose: Save the rule counters of the run as tab separated text.
+**/
+
+static bool WriteRuleStats(const QString &name, LANG_SELECT lang)
+{
+    QVector<RuleCount> counts = LANG_EN == lang ? ENPorterStemmer::ruleStats() : LVPorterStemmer::ruleStats();
+    QFile file( name );
+
+    QByteArray text = RuleStats::table( counts ).toUtf8();
+    if(!file.open( QIODevice::WriteOnly ) || file.write( text ) != text.size())
+    {
+        fprintf( stderr, "%s: %s\n", qPrintable(name), qPrintable(file.errorString()) );
+        return false;
+    }
+
+    return true;
+}
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication a(argc, argv);
+    QCoreApplication::setApplicationName( "QtPorterStemmerCli" );
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription( "Stems whitespace separated UTF-8 tokens, one stem per output line." );
+    parser.addHelpOption();
+    QCommandLineOption langOption( QStringList() << "l" << "lang", "Stemmer language, lv or en (default lv).", "lang", "lv" );
+    QCommandLineOption threadsOption( QStringList() << "j" << "threads", "Worker threads, 0 for one per core (default 1).", "n", "1" );
+    QCommandLineOption freqOption( QStringList() << "f" << "freq", "Count stem frequencies of the files instead of stemming a stream." );
+    parser.addOption( langOption );
+    parser.addOption( threadsOption );
+    QCommandLineOption statsOption( "rule-stats", "Write per rule counters to file (needs a CONFIG+=stemmer_rule_stats build).", "file" );
+    parser.addOption( freqOption );
+    parser.addOption( statsOption );
+    QCommandLineOption rulesOption( "rules", "Stem with a rule automaton image from QtPorterStemmerRulec instead of the built-in rules.", "file" );
+    parser.addOption( rulesOption );
+    QCommandLineOption dictOption( "dict", "Look tokens up in a dictionary from QtPorterStemmerDict first, stem only the rest.", "file" );
+    parser.addOption( dictOption );
+    parser.addPositionalArgument( "files", "Input files, stdin when none or -.", "[files...]" );
+    parser.process( a );
+
+    LANG_SELECT lang;
+    if(parser.value( langOption ) == "lv")
+        lang = LANG_LV;
+    else if(parser.value( langOption ) == "en")
+        lang = LANG_EN;
+    else
+    {
+        fprintf( stderr, "Unknown language %s\n", qPrintable(parser.value( langOption )) );
+        return 1;
+    }
+
+    int threads = parser.value( threadsOption ).toInt();
+    if(threads <= 0)
+        threads = QThread::idealThreadCount();
+    if(threads <= 0)
+        threads = 1;
+
+#ifndef STEMMER_RULE_STATS
+    if(parser.isSet( statsOption ))
+    {
+        fprintf( stderr, "--rule-stats needs a build with CONFIG+=stemmer_rule_stats\n" );
+        return 1;
+    }
+#endif
+
+    RuleAutomaton automaton;
+    const RuleAutomaton *rules = NULL;
+    if(parser.isSet( rulesOption ))
+    {
+        if(parser.isSet( freqOption ) || parser.isSet( statsOption ))
+        {
+            fprintf( stderr, "--rules cannot be combined with --freq or --rule-stats\n" );
+            return 1;
+        }
+        if(!automaton.load( parser.value( rulesOption ) ))
+        {
+            fprintf( stderr, "%s\n", qPrintable(automaton.errorString()) );
+            return 1;
+        }
+        rules = &automaton;
+    }
+
+    StemDictionary stemDictionary;
+    const StemDictionary *dictionary = NULL;
+    if(parser.isSet( dictOption ))
+    {
+        if(parser.isSet( freqOption ))
+        {
+            fprintf( stderr, "--dict cannot be combined with --freq\n" );
+            return 1;
+        }
+        if(!stemDictionary.load( parser.value( dictOption ) ))
+        {
+            fprintf( stderr, "%s\n", qPrintable(stemDictionary.errorString()) );
+            return 1;
+        }
+        if(stemDictionary.language() != parser.value( langOption ))
+        {
+            fprintf( stderr, "%s holds %s stems, not %s\n", qPrintable(parser.value( dictOption )),
+                     qPrintable(stemDictionary.language()), qPrintable(parser.value( langOption )) );
+            return 1;
+        }
+        dictionary = &stemDictionary;
+    }
+
+    QFile out;
+    out.open( stdout, QIODevice::WriteOnly );
+
+    QStringList files = parser.positionalArguments();
+    if(parser.isSet( freqOption ))
+    {
+        if(files.isEmpty() || files.contains( "-" ))
+        {
+            fprintf( stderr, "--freq needs input files, stdin cannot be mapped\n" );
+            return 1;
+        }
+        int result = CountFiles( files, out, lang, threads );
+        out.flush();
+        if(parser.isSet( statsOption ) && !WriteRuleStats( parser.value( statsOption ), lang ))
+            result = 1;
+        return result;
+    }
+
+    if(files.isEmpty())
+        files << "-";
+
+    int result = 0;
+    foreach(const QString &name, files)
+    {
+        QFile in;
+        bool opened;
+        if(name == "-")
+            opened = in.open( stdin, QIODevice::ReadOnly );
+        else
+        {
+            in.setFileName( name );
+            opened = in.open( QIODevice::ReadOnly );
+        }
+
+        if(!opened || !StemStream( in, out, lang, rules, dictionary, threads ))
+        {
+            fprintf( stderr, "%s: %s\n", qPrintable(name), qPrintable(in.errorString()) );
+            result = 1;
+        }
+    }
+
+    out.flush();
+    if(parser.isSet( statsOption ) && !WriteRuleStats( parser.value( statsOption ), lang ))
+        result = 1;
+    return result;
+}
@@ -0,0 +1,25 @@
+#-------------------------------------------------
+#
+# Differential check of the optimized stemming paths
+# against frozen copies of the original stemmers
+#
+#-------------------------------------------------
+
+QT       += core
+QT       -= gui
+
+TARGET = QtPorterStemmerDiff
+CONFIG   += console
+CONFIG   -= app_bundle
+TEMPLATE = app
+
+include(../stemmer.pri)
+
+DEFINES += RULES_DIR=\\\"$$PWD/../rules\\\"
+
+SOURCES += main.cpp \
+    enreferencestemmer.cpp \
+    lvreferencestemmer.cpp
+
+HEADERS  += enreferencestemmer.h \
+    lvreferencestemmer.h
@@ -0,0 +1,33 @@
+/******************************************************************
+
+   Original authors: B. Frakes and C. Cox, 1986.
+
+   Rewriten for Qt by: Raivis Strogonovs (http://morf.lv), 2016
+
+   Frozen copy of the original stemmer, the reference the optimized
+   engines are checked against by difftest. Only the class name and
+   the rule trace differ from the original; do not optimize it.
+
+   Licensed under GPLv3. See LICENCE.md file
+
+**/
+
+#ifndef ENREFERENCESTEMMER_H
+#define ENREFERENCESTEMMER_H
+
+#include <QString>
+#include <QVector>
+//#include <QDebug>
+
+class ENReferenceStemmer
+{
+public:
+    ENReferenceStemmer();
+    static QString stem(QString word);
+
+    // Same as stem(), also appends the id of every rule that fired to
+    // rules. Not reentrant, like the rest of this class.
+    static QString stem(QString word, QVector<int> *rules);
+};
+
+#endif // ENREFERENCESTEMMER_H
@@ -0,0 +1,39 @@
+/******************************************************************
+
+   Original authors: B. Frakes and C. Cox, 1986.
+
+   Latvian Stemming author: Karlis Kreslins, 1996
+
+   Rewriten for Qt by: Raivis Strogonovs (http://morf.lv), 2016
+
+   Frozen copy of the original stemmer, the reference the optimized
+   engines are checked against by difftest. Only the class name and
+   the rule trace differ from the original; do not optimize it.
+
+   Licensed under GPLv3. See LICENCE.md file
+
+
+   Special thanks to Karlis Kreslins for his work on stemming algorithm for Latvian
+   Thesis: https://dspace.lboro.ac.uk/dspace-jspui/bitstream/2134/7433/2/360860.pdf
+
+**/
+
+#ifndef LVREFERENCESTEMMER_H
+#define LVREFERENCESTEMMER_H
+
+#include <QString>
+#include <QVector>
+//#include <QDebug>
+
+class LVReferenceStemmer
+{
+public:
+    LVReferenceStemmer();
+    static QString stem(QString word);
+
+    // Same as stem(), also appends the id of every rule that fired to
+    // rules. Not reentrant, like the rest of this class.
+    static QString stem(QString word, QVector<int> *rules);
+};
+
+#endif // LVREFERENCESTEMMER_H
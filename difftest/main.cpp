@@ -0,0 +1,575 @@
+/******************************************************************
+
+   Differential harness: runs every optimized stemming path against the
+   frozen reference stemmers over word lists and random words, reports
+   the first divergence and the speed relative to the reference.
+
+   Licensed under GPLv3. See LICENCE.md file
+
+**/
+
+#include <QCoreApplication>
+#include <QCommandLineParser>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QRegExp>
+#include <QStringList>
+#include <QVarLengthArray>
+#include <QVector>
+
+#include <stdio.h>
+#include <string.h>
+
+#include "enporterstemmer.h"
+#include "enreferencestemmer.h"
+#include "lvporterstemmer.h"
+#include "lvreferencestemmer.h"
+#include "ruleautomaton.h"
+#include "rulecompiler.h"
+#include "stemcache.h"
+#include "stemdictionary.h"
+#include "steminterner.h"
+#include "textanalyzer.h"
+
+/* Small enough that a big vocabulary makes the cache evict */
+#define CACHE_BYTES  (1024 * 1024)
+
+/* The shipped rule sets, <dir>/en.rules and <dir>/lv.rules */
+#ifndef RULES_DIR
+#define RULES_DIR  "rules"
+#endif
+
+/* Index of each language in languages[] and the engines below */
+#define LANGUAGE_EN  0
+#define LANGUAGE_LV  1
+
+typedef QStringList (*RunFunction)(const QStringList &words);
+
+typedef struct {
+           const char *name;               /* path name in the report */
+           RunFunction run;
+           bool (*skip)(const QString &word);  /* words the path may stem differently, NULL for none */
+           } Path;
+
+typedef struct {
+           const char *name;                       /* "en" or "lv" */
+           QString (*reference)(QString word, QVector<int> *rules);
+           QString (*stem)(QString word);          /* built-in stemmer, fills the dictionary */
+           const Path *paths;                      /* NULL name terminated */
+           const char *alphabet;                   /* UTF-8 letters of random words */
+           const char *const *endings;             /* NULL terminated */
+           } Language;
+
+typedef struct {
+           int mismatches;
+           int skipped;                    /* differ only by the simple case mapping */
+           int first;                      /* index of the first mismatch, -1 if none */
+           } Comparison;
+
+/* Engines that need data, set up by Prepare() before the paths run */
+static RuleAutomaton automata[2];
+static StemDictionary *dictionaries[2];
+
+static bool SimpleCaseDiffers(const QString &word);
+static bool AnalyzerSplits(const QString &word);
+
+/*****************************************************************************/
+/******************************   Paths   ************************************/
+
+template <QString (*Stem)(QString)>
+static QStringList RunString(const QStringList &words)
+{
+    QStringList stems;
+
+    stems.reserve( words.size() );
+    for(int i=0; i<words.size(); i++)
+        stems.append( Stem( words.at(i) ) );
+
+    return stems;
+}
+
+template <int (*Stem)(QChar *, int)>
+static QStringList RunBuffer(const QStringList &words)
+{
+    QStringList stems;
+    QVarLengthArray<QChar, 128> buffer;
+
+    stems.reserve( words.size() );
+    for(int i=0; i<words.size(); i++)
+    {
+        const QString &word = words.at(i);
+        buffer.resize( word.length() );
+        memcpy( buffer.data(), word.constData(), word.length() * sizeof(QChar) );
+        stems.append( QString( buffer.constData(), Stem( buffer.data(), word.length() ) ) );
+    }
+
+    return stems;
+}
+
+static QStringList RunUtf8(const QStringList &words)
+{
+    QStringList stems;
+    QVarLengthArray<char, 256> out;
+
+    stems.reserve( words.size() );
+    for(int i=0; i<words.size(); i++)
+    {
+        QByteArray word = words.at(i).toUtf8();
+        out.resize( 3 * word.size() + 1 );
+        int size = ENPorterStemmer::stem( word.constData(), word.size(), out.data(), out.size() );
+        if(size > out.size())
+        {
+            out.resize( size );
+            ENPorterStemmer::stem( word.constData(), word.size(), out.data(), out.size() );
+        }
+        stems.append( QString::fromUtf8( out.constData(), size ) );
+    }
+
+    return stems;
+}
+
+template <QString (*Stem)(QString)>
+static QStringList RunCache(const QStringList &words)
+{
+    StemCache cache( Stem, CACHE_BYTES );
+    QStringList stems;
+
+    stems.reserve( words.size() );
+    for(int i=0; i<words.size(); i++)
+        stems.append( cache.stem( words.at(i) ) );
+
+    return stems;
+}
+
+template <int Language>
+static QStringList RunAutomaton(const QStringList &words)
+{
+    QStringList stems;
+
+    stems.reserve( words.size() );
+    for(int i=0; i<words.size(); i++)
+        stems.append( automata[Language].stem( words.at(i) ) );
+
+    return stems;
+}
+
+template <int Language>
+static QStringList RunDictionary(const QStringList &words)
+{
+    QStringList stems;
+
+    stems.reserve( words.size() );
+    for(int i=0; i<words.size(); i++)
+        stems.append( dictionaries[Language]->stem( words.at(i) ) );
+
+    return stems;
+}
+
+/* A word the analyzer does not read as one token gets a null stem,
+   AnalyzerSplits() skips it */
+template <int (*Stem)(QChar *, int)>
+static QStringList RunAnalyzer(const QStringList &words)
+{
+    TextAnalyzer analyzer( Stem );
+    QStringList stems;
+
+    stems.reserve( words.size() );
+    for(int i=0; i<words.size(); i++)
+    {
+        const QString &word = words.at(i);
+        if(1 == analyzer.analyze( word ) && word.length() == analyzer.token(0).length)
+            stems.append( analyzer.stem(0) );
+        else
+            stems.append( QString() );
+    }
+
+    return stems;
+}
+
+/* One interner for the whole list, so repeated stems take the lookup path */
+template <int (*Stem)(QChar *, int)>
+static QStringList RunInterner(const QStringList &words)
+{
+    StemInterner interner( Stem );
+    QStringList stems;
+
+    stems.reserve( words.size() );
+    for(int i=0; i<words.size(); i++)
+        stems.append( interner.string( interner.stem( words.at(i) ) ) );
+
+    return stems;
+}
+
+static const Path en_paths[] =
+           {
+             {"qstring",    RunString<ENPorterStemmer::stem>,    NULL},
+             {"buffer",     RunBuffer<ENPorterStemmer::stem>,    SimpleCaseDiffers},
+             {"utf8",       RunUtf8,                             NULL},
+             {"batch",      ENPorterStemmer::stemBatch,          NULL},
+             {"cache",      RunCache<ENPorterStemmer::stem>,     NULL},
+             {"automaton",  RunAutomaton<LANGUAGE_EN>,           NULL},
+             {"dictionary", RunDictionary<LANGUAGE_EN>,          NULL},
+             {"analyzer",   RunAnalyzer<ENPorterStemmer::stem>,  AnalyzerSplits},
+             {"interner",   RunInterner<ENPorterStemmer::stem>,  SimpleCaseDiffers},
+             {NULL,         NULL,                                NULL},
+           };
+
+static const Path lv_paths[] =
+           {
+             {"qstring",    RunString<LVPorterStemmer::stem>,    NULL},
+             {"buffer",     RunBuffer<LVPorterStemmer::stem>,    SimpleCaseDiffers},
+             {"batch",      LVPorterStemmer::stemBatch,          NULL},
+             {"cache",      RunCache<LVPorterStemmer::stem>,     NULL},
+             {"automaton",  RunAutomaton<LANGUAGE_LV>,           NULL},
+             {"dictionary", RunDictionary<LANGUAGE_LV>,          NULL},
+             {"analyzer",   RunAnalyzer<LVPorterStemmer::stem>,  AnalyzerSplits},
+             {"interner",   RunInterner<LVPorterStemmer::stem>,  SimpleCaseDiffers},
+             {NULL,         NULL,                                NULL},
+           };
+
+/* Endings of random words, picked so most rules get a chance to fire */
+static const char *const en_endings[] =
+           {
+             "", "", "s", "es", "ies", "sses", "ss", "ed", "eed", "ing", "ated", "bling",
+             "izing", "ying", "ational", "tional", "enci", "anci", "izer", "abli",
+             "alli", "entli", "eli", "ousli", "ization", "ation", "ator", "alism",
+             "iveness", "fulness", "ousness", "aliti", "iviti", "biliti", "icate",
+             "ative", "alize", "iciti", "ical", "ful", "ness", "al", "ance", "ence",
+             "er", "ic", "able", "ible", "ant", "ement", "ment", "ent", "sion", "tion",
+             "ou", "ism", "ate", "iti", "ous", "ive", "ize", "e", "ll", "y",
+             NULL
+           };
+
+static const char *const lv_endings[] =
+           {
+             "", "", "s", "š", "is", "us", "a", "e", "i", "u", "ā", "ē", "ī", "ū",
+             "am", "em", "im", "um", "ām", "ēm", "īm", "os", "ās", "ēs", "ajam",
+             "ajai", "ajiem", "ajām", "ākais", "ākā", "ībā", "šana", "šanas", "tājs",
+             "nieks", "ums", "īgs", "ējs", "iem", "ēt", "īt", "ot", "ties", "jās",
+             "ieties", "oties", "ējies", "ušies", "dams", "damies", "ošs", "ošā",
+             "ībai", "ību", "ības", "umu", "umā", "ēji", "āji", "inā", "iņš", "iņa",
+             NULL
+           };
+
+/* In LANGUAGE_EN, LANGUAGE_LV order */
+static const Language languages[] =
+           {
+             {"en", ENReferenceStemmer::stem, ENPorterStemmer::stem, en_paths,
+              "abcdefghijklmnopqrstuvwxyz", en_endings},
+             {"lv", LVReferenceStemmer::stem, LVPorterStemmer::stem, lv_paths,
+              "aābcčdeēfgģhiījkķlļmnņoprsštuūvzž", lv_endings},
+           };
+
+
+/*****************************************************************************/
+/*************************   Vocabularies   **********************************/
+
+/* xorshift64*, so the random words are the same on every platform */
+static quint64 NextRandom(quint64 &state)
+{
+    state ^= state >> 12;
+    state ^= state << 25;
+    state ^= state >> 27;
+    return state * Q_UINT64_C(2685821657736338717);
+}
+
+/*FN**************************************************************************
+
+       RandomWords( language, count, seed )
+
+   Returns: QStringList -- count pseudo random words
+
+   Plan:    A root of one to eight letters from the alphabet plus one of
+            the endings.  A few words get upper case letters, digits,
+            hyphens or letters from outside the alphabet so the case
+            folding and the non alphabetic exits are exercised too.
+**/
+
+static QStringList RandomWords(const Language &language, int count, quint64 seed)
+{
+    QString alphabet = QString::fromUtf8( language.alphabet );
+    QString odd = QString::fromUtf8( "ABCĀČŠŽÉÄß-'0é" );
+    QStringList endings;
+    QStringList words;
+    quint64 state = seed ? seed : 1;
+
+    for(int i=0; language.endings[i]; i++)
+        endings.append( QString::fromUtf8( language.endings[i] ) );
+
+    words.reserve( count );
+    for(int i=0; i<count; i++)
+    {
+        QString word;
+        int length = 1 + int(NextRandom( state ) % 8);
+        for(int j=0; j<length; j++)
+            word.append( alphabet.at( int(NextRandom( state ) % alphabet.length()) ) );
+        word.append( endings.at( int(NextRandom( state ) % endings.size()) ) );
+
+        quint64 shape = NextRandom( state ) % 64;
+        if(shape < 4)
+            word = word.toUpper();
+        else if(shape < 8)
+            word[0] = word.at(0).toUpper();
+        else if(shape < 10)
+            word[int(NextRandom( state ) % word.length())] = odd.at( int(NextRandom( state ) % odd.length()) );
+
+        words.append( word );
+    }
+
+    return words;
+}
+
+static bool ReadWords(const QString &fileName, QStringList &words)
+{
+    QFile file( fileName );
+
+    if(!file.open( QIODevice::ReadOnly ))
+    {
+        fprintf( stderr, "%s: %s\n", qPrintable(fileName), qPrintable(file.errorString()) );
+        return false;
+    }
+
+    words.append( QString::fromUtf8( file.readAll() ).split( QRegExp( "\\s+" ), QString::SkipEmptyParts ) );
+    return true;
+}
+
+/*FN**************************************************************************
+
+       Prepare( index, rulesDir, words )
+
+   Returns: bool -- false if the language's rule set does not compile
+
+   Purpose: Compile <rulesDir>/<name>.rules for the automaton path and
+            build the dictionary of the dictionary path from every
+            second word, so it is checked both on hits and on words it
+            hands to the stemmer.
+**/
+
+static bool Prepare(int index, const QString &rulesDir, const QStringList &words)
+{
+    const Language &language = languages[index];
+    QString fileName = rulesDir + "/" + language.name + ".rules";
+    QFile file( fileName );
+    RuleCompiler compiler;
+
+    if(!file.open( QIODevice::ReadOnly ))
+    {
+        fprintf( stderr, "%s: %s\n", qPrintable(fileName), qPrintable(file.errorString()) );
+        return false;
+    }
+    if(!compiler.compile( QString::fromUtf8( file.readAll() ) ) || !automata[index].setImage( compiler.image() ))
+    {
+        fprintf( stderr, "%s: %s\n", qPrintable(fileName),
+                 qPrintable(compiler.errorString().isEmpty() ? automata[index].errorString() : compiler.errorString()) );
+        return false;
+    }
+
+    QStringList known;
+    QStringList stems;
+    for(int i=0; i<words.size(); i+=2)
+    {
+        known.append( words.at(i) );
+        stems.append( language.stem( words.at(i) ) );
+    }
+    delete dictionaries[index];
+    dictionaries[index] = new StemDictionary( language.stem );
+    dictionaries[index]->setImage( StemDictionary::build( language.name, known, stems ) );
+
+    return true;
+}
+
+
+/*****************************************************************************/
+/****************************   Checking   ***********************************/
+
+/* The buffer entry points lower with QChar::toLower() one character at a
+   time, which differs from QString::toLower() for a few letters */
+static bool SimpleCaseDiffers(const QString &word)
+{
+    QString lowered = word.toLower();
+
+    if(lowered.length() != word.length())
+        return true;
+    for(int i=0; i<word.length(); i++)
+    {
+        if(word.at(i).toLower() != lowered.at(i))
+            return true;
+    }
+    return false;
+}
+
+/* The analyzer splits words at digits and punctuation, and lowers one
+   character at a time like the buffer paths */
+static bool AnalyzerSplits(const QString &word)
+{
+    TextAnalyzer analyzer( ENPorterStemmer::stem );
+
+    if(1 != analyzer.analyze( word ) || word.length() != analyzer.token(0).length)
+        return true;
+
+    return SimpleCaseDiffers( word );
+}
+
+static Comparison Compare(const Path &path, const QStringList &words, const QStringList &expected, const QStringList &stems)
+{
+    Comparison comparison;
+
+    comparison.mismatches = 0;
+    comparison.skipped = 0;
+    comparison.first = -1;
+    for(int i=0; i<words.size(); i++)
+    {
+        if(stems.at(i) == expected.at(i))
+            continue;
+        if(NULL != path.skip && path.skip( words.at(i) ))
+        {
+            comparison.skipped++;
+            continue;
+        }
+        if(comparison.first < 0)
+            comparison.first = i;
+        comparison.mismatches++;
+    }
+
+    return comparison;
+}
+
+/* Best of runs, in nanoseconds */
+static qint64 Time(RunFunction run, const QStringList &words, int runs, QStringList &stems)
+{
+    qint64 best = -1;
+
+    for(int i=0; i<runs; i++)
+    {
+        QElapsedTimer timer;
+        timer.start();
+        stems = run( words );
+        qint64 nsecs = timer.nsecsElapsed();
+        if(best < 0 || nsecs < best)
+            best = nsecs;
+    }
+
+    return qMax( best, qint64(1) );
+}
+
+static QStringList RunReference(const QStringList &words, const Language &language)
+{
+    QStringList stems;
+
+    stems.reserve( words.size() );
+    for(int i=0; i<words.size(); i++)
+        stems.append( language.reference( words.at(i), NULL ) );
+
+    return stems;
+}
+
+/*FN**************************************************************************
+
+       CheckLanguage( language, words, runs )
+
+   Returns: int -- the number of mismatching words over all paths
+
+   Purpose: Print one line per path with its mismatches and its speed
+            relative to the reference, and the first divergence of each
+            failing path with the rules the reference fired for it.
+**/
+
+static int CheckLanguage(const Language &language, const QStringList &words, int runs)
+{
+    QStringList expected;
+    qint64 reference = -1;
+    int failures = 0;
+
+    for(int i=0; i<runs; i++)
+    {
+        QElapsedTimer timer;
+        timer.start();
+        expected = RunReference( words, language );
+        qint64 nsecs = timer.nsecsElapsed();
+        if(reference < 0 || nsecs < reference)
+            reference = nsecs;
+    }
+    reference = qMax( reference, qint64(1) );
+
+    printf( "%s  reference  %d words  %.1f ns/word\n", language.name, words.size(),
+            double(reference) / qMax( words.size(), 1 ) );
+
+    for(int p=0; language.paths[p].name; p++)
+    {
+        const Path &path = language.paths[p];
+        QStringList stems;
+        qint64 nsecs = Time( path.run, words, runs, stems );
+        Comparison comparison = Compare( path, words, expected, stems );
+
+        printf( "%s  %-10s  %d mismatches  %d skipped  %.1f ns/word  %.2fx reference\n",
+                language.name, path.name, comparison.mismatches, comparison.skipped,
+                double(nsecs) / qMax( words.size(), 1 ), double(reference) / nsecs );
+
+        if(comparison.first >= 0)
+        {
+            QVector<int> rules;
+            const QString &word = words.at(comparison.first);
+            language.reference( word, &rules );
+
+            QString fired;
+            for(int i=0; i<rules.size(); i++)
+                fired += (i ? " " : "") + QString::number( rules.at(i) );
+
+            printf( "%s  %-10s  first divergence at word %d \"%s\": reference \"%s\" (rules %s), got \"%s\"\n",
+                    language.name, path.name, comparison.first, qPrintable(word),
+                    qPrintable(expected.at(comparison.first)), qPrintable(fired.isEmpty() ? QString( "none" ) : fired),
+                    qPrintable(stems.at(comparison.first)) );
+        }
+
+        failures += comparison.mismatches;
+    }
+
+    return failures;
+}
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication a(argc, argv);
+    QCoreApplication::setApplicationName( "QtPorterStemmerDiff" );
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription( "Checks every optimized stemming path against the frozen reference stemmers." );
+    parser.addHelpOption();
+    QCommandLineOption enOption( "en", "English vocabulary file, whitespace separated. Repeatable.", "file" );
+    QCommandLineOption lvOption( "lv", "Latvian vocabulary file, whitespace separated. Repeatable.", "file" );
+    QCommandLineOption randomOption( "random", "Random words added per language (default 100000).", "n", "100000" );
+    QCommandLineOption seedOption( "seed", "Seed of the random words (default 1).", "n", "1" );
+    QCommandLineOption runsOption( QStringList() << "r" << "runs", "Timed runs per path, the best is kept (default 3).", "n", "3" );
+    QCommandLineOption rulesOption( "rules", "Directory of en.rules and lv.rules (default " RULES_DIR ").", "dir", RULES_DIR );
+    parser.addOption( enOption );
+    parser.addOption( lvOption );
+    parser.addOption( randomOption );
+    parser.addOption( seedOption );
+    parser.addOption( runsOption );
+    parser.addOption( rulesOption );
+    parser.process( a );
+
+    int random = qMax( 0, parser.value( randomOption ).toInt() );
+    quint64 seed = parser.value( seedOption ).toULongLong();
+    int runs = qMax( 1, parser.value( runsOption ).toInt() );
+
+    int failures = 0;
+    for(int i=0; i<int(sizeof(languages) / sizeof(languages[0])); i++)
+    {
+        QStringList words;
+        QStringList files = parser.values( 0 == i ? enOption : lvOption );
+        foreach(const QString &file, files)
+        {
+            if(!ReadWords( file, words ))
+                return 2;
+        }
+        words.append( RandomWords( languages[i], random, seed ) );
+        if(!Prepare( i, parser.value( rulesOption ), words ))
+            return 2;
+
+        failures += CheckLanguage( languages[i], words, runs );
+    }
+
+    printf( "%s\n", failures ? "FAILED" : "OK" );
+    return failures ? 1 : 0;
+}
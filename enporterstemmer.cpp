@@ -9,227 +9,260 @@
 **/
 
 #include "enporterstemmer.h"
+#include "lowercase.h"
+#include "porterengine.h"
+#include "stembatch.h"
+
+#include <QVarLengthArray>
+
+#include <string.h>
 
 /*****************************************************************************/
 /*****************   Private Defines and Data Structures   *******************/
 #define IsVowel(c)        ('a'==(c)||'e'==(c)||'i'==(c)||'o'==(c)||'u'==(c))
 
+/* Rule conditions, tested by ENLanguage::condition() */
+enum {
+           CONTAINS_VOWEL = 1,     /* ContainsVowel() */
+           ADD_AN_E,               /* AddAnE() */
+           REMOVE_AN_E,            /* RemoveAnE() */
+           };
+
+/* English for PorterEngine */
+struct ENLanguage
+{
+    static bool isVowel(QChar c) { return IsVowel(c); }
+    static int condition(int condition, PorterContext &ctx);
+    static int runSteps(PorterContext &ctx, int steps);
+#ifdef STEMMER_RULE_STATS
+    static RuleStats *ruleStats();
+#endif
+};
+
+typedef PorterEngine<ENLanguage> ENEngine;
+
+/* Step tables compiled into reversed-suffix tries, see Tables() */
 typedef struct {
-           int id;                 /* returned if rule fired */
-           QString old_end;          /* suffix replaced */
-           QString new_end;          /* suffix replacement */
-           int old_offset;         /* from end of word to start of suffix */
-           int new_offset;         /* from beginning to end of new suffix */
-           int min_root_size;      /* min root word size for replacement */
-           int (*condition)(QString &);     /* the replacement test function */
-           } RuleList;
+           SuffixTrie step1a;
+           SuffixTrie step1b;
+           SuffixTrie step1b1;
+           SuffixTrie step1c;
+           SuffixTrie step2;
+           SuffixTrie step3;
+           SuffixTrie step4;
+           SuffixTrie step5a;
+           SuffixTrie step5b;
+           } ENTables;
 
 //static char LAMBDA[1] = "";        /* the constant empty string */
-static QString LAMBDA = "";
-//static char *end;
-static int endIndex;
+#define LAMBDA  U16("")         /* the constant empty string */
 
 /*****************************************************************************/
 /********************   Private Function Declarations   **********************/
-static int WordSize( QString &word  );
-static int ContainsVowel( QString &word );
-static int EndsWithCVC( QString &word  );
-static int AddAnE( QString &word  );
-static int RemoveAnE( QString &word  );
-static int ReplaceEnd( QString & word, RuleList * rule );
+static int IsOneOf( QChar ch, const char *set );
+static int ContainsVowel( PorterContext &ctx );
+static int EndsWithCVC( PorterContext &ctx  );
+static int AddAnE( PorterContext &ctx  );
+static int RemoveAnE( PorterContext &ctx  );
+static const ENTables &Tables();
+#ifdef STEMMER_RULE_STATS
+static RuleStats *CompileRuleStats();
+#endif
 
 
 /******************************************************************************/
 /*****************   Initialized Private Data Structures   ********************/
 
-static RuleList step1a_rules[] =
+static const PorterRule step1a_rules[] =
            {
-                {101,  "sses",      "ss",    3,  1, -1,  NULL},
-                {102,  "ies",       "i",     2,  0, -1,  NULL},
-                {103,  "ss",        "ss",    1,  1, -1,  NULL},
-                {104,  "s",         LAMBDA,  0, -1, -1,  NULL},
-                {000,  NULL,        NULL,    0,  0,  0,  NULL},
+                {101,  U16("sses"),      U16("ss"),    3,  1, -1,  NO_CONDITION},
+                {102,  U16("ies"),       U16("i"),     2,  0, -1,  NO_CONDITION},
+                {103,  U16("ss"),        U16("ss"),    1,  1, -1,  NO_CONDITION},
+                {104,  U16("s"),         LAMBDA,  0, -1, -1,  NO_CONDITION},
+                {000,  {NULL, 0},        {NULL, 0},    0,  0,  0,  NO_CONDITION},
            };
 
-static RuleList step1b_rules[] =
+static const PorterRule step1b_rules[] =
            {
-                {105,  "eed",       "ee",    2,  1,  0,  NULL},
-                {106,  "ed",        LAMBDA,  1, -1, -1,  ContainsVowel},
-                {107,  "ing",       LAMBDA,  2, -1, -1,  ContainsVowel},
-                {000,  NULL,        NULL,    0,  0,  0,  NULL},
+                {105,  U16("eed"),       U16("ee"),    2,  1,  0,  NO_CONDITION},
+                {106,  U16("ed"),        LAMBDA,  1, -1, -1,  CONTAINS_VOWEL},
+                {107,  U16("ing"),       LAMBDA,  2, -1, -1,  CONTAINS_VOWEL},
+                {000,  {NULL, 0},        {NULL, 0},    0,  0,  0,  NO_CONDITION},
            };
 
-static RuleList step1b1_rules[] =
+static const PorterRule step1b1_rules[] =
            {
-             {108,  "at",        "ate",   1,  2, -1,  NULL},
-             {109,  "bl",        "ble",   1,  2, -1,  NULL},
-             {110,  "iz",        "ize",   1,  2, -1,  NULL},
-             {111,  "bb",        "b",     1,  0, -1,  NULL},
-             {112,  "dd",        "d",     1,  0, -1,  NULL},
-             {113,  "ff",        "f",     1,  0, -1,  NULL},
-             {114,  "gg",        "g",     1,  0, -1,  NULL},
-             {115,  "mm",        "m",     1,  0, -1,  NULL},
-             {116,  "nn",        "n",     1,  0, -1,  NULL},
-             {117,  "pp",        "p",     1,  0, -1,  NULL},
-             {118,  "rr",        "r",     1,  0, -1,  NULL},
-             {119,  "tt",        "t",     1,  0, -1,  NULL},
-             {120,  "ww",        "w",     1,  0, -1,  NULL},
-             {121,  "xx",        "x",     1,  0, -1,  NULL},
-             {122,  LAMBDA,      "e",    -1,  0, -1,  AddAnE},
-             {000,  NULL,        NULL,    0,  0,  0,  NULL},
+             {108,  U16("at"),        U16("ate"),   1,  2, -1,  NO_CONDITION},
+             {109,  U16("bl"),        U16("ble"),   1,  2, -1,  NO_CONDITION},
+             {110,  U16("iz"),        U16("ize"),   1,  2, -1,  NO_CONDITION},
+             {111,  U16("bb"),        U16("b"),     1,  0, -1,  NO_CONDITION},
+             {112,  U16("dd"),        U16("d"),     1,  0, -1,  NO_CONDITION},
+             {113,  U16("ff"),        U16("f"),     1,  0, -1,  NO_CONDITION},
+             {114,  U16("gg"),        U16("g"),     1,  0, -1,  NO_CONDITION},
+             {115,  U16("mm"),        U16("m"),     1,  0, -1,  NO_CONDITION},
+             {116,  U16("nn"),        U16("n"),     1,  0, -1,  NO_CONDITION},
+             {117,  U16("pp"),        U16("p"),     1,  0, -1,  NO_CONDITION},
+             {118,  U16("rr"),        U16("r"),     1,  0, -1,  NO_CONDITION},
+             {119,  U16("tt"),        U16("t"),     1,  0, -1,  NO_CONDITION},
+             {120,  U16("ww"),        U16("w"),     1,  0, -1,  NO_CONDITION},
+             {121,  U16("xx"),        U16("x"),     1,  0, -1,  NO_CONDITION},
+             {122,  LAMBDA,      U16("e"),    -1,  0, -1,  ADD_AN_E},
+             {000,  {NULL, 0},        {NULL, 0},    0,  0,  0,  NO_CONDITION},
              };
 
-static RuleList step1c_rules[] =
+static const PorterRule step1c_rules[] =
            {
-             {123,  "y",         "i",      0,  0, -1,  ContainsVowel},
-             {000,  NULL,        NULL,    0,  0,  0,  NULL},
+             {123,  U16("y"),         U16("i"),      0,  0, -1,  CONTAINS_VOWEL},
+             {000,  {NULL, 0},        {NULL, 0},    0,  0,  0,  NO_CONDITION},
            };
 
-static RuleList step2_rules[] =
+static const PorterRule step2_rules[] =
            {
-             {203,  "ational",   "ate",   6,  2,  0,  NULL},
-             {204,  "tional",    "tion",  5,  3,  0,  NULL},
-             {205,  "enci",      "ence",  3,  3,  0,  NULL},
-             {206,  "anci",      "ance",  3,  3,  0,  NULL},
-             {207,  "izer",      "ize",   3,  2,  0,  NULL},
-             {208,  "abli",      "able",  3,  3,  0,  NULL},
-             {209,  "alli",      "al",    3,  1,  0,  NULL},
-             {210,  "entli",     "ent",   4,  2,  0,  NULL},
-             {211,  "eli",       "e",     2,  0,  0,  NULL},
-             {213,  "ousli",     "ous",   4,  2,  0,  NULL},
-             {214,  "ization",   "ize",   6,  2,  0,  NULL},
-             {215,  "ation",     "ate",   4,  2,  0,  NULL},
-             {216,  "ator",      "ate",   3,  2,  0,  NULL},
-             {217,  "alism",     "al",    4,  1,  0,  NULL},
-             {218,  "iveness",   "ive",   6,  2,  0,  NULL},
-             {219,  "fulnes",    "ful",   5,  2,  0,  NULL},
-             {220,  "ousness",   "ous",   6,  2,  0,  NULL},
-             {221,  "aliti",     "al",    4,  1,  0,  NULL},
-             {222,  "iviti",     "ive",   4,  2,  0,  NULL},
-             {223,  "biliti",    "ble",   5,  2,  0,  NULL},
-             {000,  NULL,        NULL,    0,  0,  0,  NULL},
+             {203,  U16("ational"),   U16("ate"),   6,  2,  0,  NO_CONDITION},
+             {204,  U16("tional"),    U16("tion"),  5,  3,  0,  NO_CONDITION},
+             {205,  U16("enci"),      U16("ence"),  3,  3,  0,  NO_CONDITION},
+             {206,  U16("anci"),      U16("ance"),  3,  3,  0,  NO_CONDITION},
+             {207,  U16("izer"),      U16("ize"),   3,  2,  0,  NO_CONDITION},
+             {208,  U16("abli"),      U16("able"),  3,  3,  0,  NO_CONDITION},
+             {209,  U16("alli"),      U16("al"),    3,  1,  0,  NO_CONDITION},
+             {210,  U16("entli"),     U16("ent"),   4,  2,  0,  NO_CONDITION},
+             {211,  U16("eli"),       U16("e"),     2,  0,  0,  NO_CONDITION},
+             {213,  U16("ousli"),     U16("ous"),   4,  2,  0,  NO_CONDITION},
+             {214,  U16("ization"),   U16("ize"),   6,  2,  0,  NO_CONDITION},
+             {215,  U16("ation"),     U16("ate"),   4,  2,  0,  NO_CONDITION},
+             {216,  U16("ator"),      U16("ate"),   3,  2,  0,  NO_CONDITION},
+             {217,  U16("alism"),     U16("al"),    4,  1,  0,  NO_CONDITION},
+             {218,  U16("iveness"),   U16("ive"),   6,  2,  0,  NO_CONDITION},
+             {219,  U16("fulnes"),    U16("ful"),   5,  2,  0,  NO_CONDITION},
+             {220,  U16("ousness"),   U16("ous"),   6,  2,  0,  NO_CONDITION},
+             {221,  U16("aliti"),     U16("al"),    4,  1,  0,  NO_CONDITION},
+             {222,  U16("iviti"),     U16("ive"),   4,  2,  0,  NO_CONDITION},
+             {223,  U16("biliti"),    U16("ble"),   5,  2,  0,  NO_CONDITION},
+             {000,  {NULL, 0},        {NULL, 0},    0,  0,  0,  NO_CONDITION},
            };
 
-static RuleList step3_rules[] =
+static const PorterRule step3_rules[] =
            {
-             {301,  "icate",     "ic",    4,  1,  0,  NULL},
-             {302,  "ative",     LAMBDA,  4, -1,  0,  NULL},
-             {303,  "alize",     "al",    4,  1,  0,  NULL},
-             {304,  "iciti",     "ic",    4,  1,  0,  NULL},
-             {305,  "ical",      "ic",    3,  1,  0,  NULL},
-             {308,  "ful",       LAMBDA,  2, -1,  0,  NULL},
-             {309,  "ness",      LAMBDA,  3, -1,  0,  NULL},
-             {000,  NULL,        NULL,    0,  0,  0,  NULL},
+             {301,  U16("icate"),     U16("ic"),    4,  1,  0,  NO_CONDITION},
+             {302,  U16("ative"),     LAMBDA,  4, -1,  0,  NO_CONDITION},
+             {303,  U16("alize"),     U16("al"),    4,  1,  0,  NO_CONDITION},
+             {304,  U16("iciti"),     U16("ic"),    4,  1,  0,  NO_CONDITION},
+             {305,  U16("ical"),      U16("ic"),    3,  1,  0,  NO_CONDITION},
+             {308,  U16("ful"),       LAMBDA,  2, -1,  0,  NO_CONDITION},
+             {309,  U16("ness"),      LAMBDA,  3, -1,  0,  NO_CONDITION},
+             {000,  {NULL, 0},        {NULL, 0},    0,  0,  0,  NO_CONDITION},
            };
 
-static RuleList step4_rules[] =
+static const PorterRule step4_rules[] =
            {
-             {401,  "al",        LAMBDA,  1, -1,  1,  NULL},
-             {402,  "ance",      LAMBDA,  3, -1,  1,  NULL},
-             {403,  "ence",      LAMBDA,  3, -1,  1,  NULL},
-             {405,  "er",        LAMBDA,  1, -1,  1,  NULL},
-             {406,  "ic",        LAMBDA,  1, -1,  1,  NULL},
-             {407,  "able",      LAMBDA,  3, -1,  1,  NULL},
-             {408,  "ible",      LAMBDA,  3, -1,  1,  NULL},
-             {409,  "ant",       LAMBDA,  2, -1,  1,  NULL},
-             {410,  "ement",     LAMBDA,  4, -1,  1,  NULL},
-             {411,  "ment",      LAMBDA,  3, -1,  1,  NULL},
-             {412,  "ent",       LAMBDA,  2, -1,  1,  NULL},
-             {423,  "sion",      "s",     3,  0,  1,  NULL},
-             {424,  "tion",      "t",     3,  0,  1,  NULL},
-             {415,  "ou",        LAMBDA,  1, -1,  1,  NULL},
-             {416,  "ism",       LAMBDA,  2, -1,  1,  NULL},
-             {417,  "ate",       LAMBDA,  2, -1,  1,  NULL},
-             {418,  "iti",       LAMBDA,  2, -1,  1,  NULL},
-             {419,  "ous",       LAMBDA,  2, -1,  1,  NULL},
-             {420,  "ive",       LAMBDA,  2, -1,  1,  NULL},
-             {421,  "ize",       LAMBDA,  2, -1,  1,  NULL},
-             {000,  NULL,        NULL,    0,  0,  0,  NULL},
+             {401,  U16("al"),        LAMBDA,  1, -1,  1,  NO_CONDITION},
+             {402,  U16("ance"),      LAMBDA,  3, -1,  1,  NO_CONDITION},
+             {403,  U16("ence"),      LAMBDA,  3, -1,  1,  NO_CONDITION},
+             {405,  U16("er"),        LAMBDA,  1, -1,  1,  NO_CONDITION},
+             {406,  U16("ic"),        LAMBDA,  1, -1,  1,  NO_CONDITION},
+             {407,  U16("able"),      LAMBDA,  3, -1,  1,  NO_CONDITION},
+             {408,  U16("ible"),      LAMBDA,  3, -1,  1,  NO_CONDITION},
+             {409,  U16("ant"),       LAMBDA,  2, -1,  1,  NO_CONDITION},
+             {410,  U16("ement"),     LAMBDA,  4, -1,  1,  NO_CONDITION},
+             {411,  U16("ment"),      LAMBDA,  3, -1,  1,  NO_CONDITION},
+             {412,  U16("ent"),       LAMBDA,  2, -1,  1,  NO_CONDITION},
+             {423,  U16("sion"),      U16("s"),     3,  0,  1,  NO_CONDITION},
+             {424,  U16("tion"),      U16("t"),     3,  0,  1,  NO_CONDITION},
+             {415,  U16("ou"),        LAMBDA,  1, -1,  1,  NO_CONDITION},
+             {416,  U16("ism"),       LAMBDA,  2, -1,  1,  NO_CONDITION},
+             {417,  U16("ate"),       LAMBDA,  2, -1,  1,  NO_CONDITION},
+             {418,  U16("iti"),       LAMBDA,  2, -1,  1,  NO_CONDITION},
+             {419,  U16("ous"),       LAMBDA,  2, -1,  1,  NO_CONDITION},
+             {420,  U16("ive"),       LAMBDA,  2, -1,  1,  NO_CONDITION},
+             {421,  U16("ize"),       LAMBDA,  2, -1,  1,  NO_CONDITION},
+             {000,  {NULL, 0},        {NULL, 0},    0,  0,  0,  NO_CONDITION},
            };
 
-static RuleList step5a_rules[] =
+static const PorterRule step5a_rules[] =
            {
-             {501,  "e",         LAMBDA,  0, -1,  1,  NULL},
-             {502,  "e",         LAMBDA,  0, -1, -1,  RemoveAnE},
-             {000,  NULL,        NULL,    0,  0,  0,  NULL},
+             {501,  U16("e"),         LAMBDA,  0, -1,  1,  NO_CONDITION},
+             {502,  U16("e"),         LAMBDA,  0, -1, -1,  REMOVE_AN_E},
+             {000,  {NULL, 0},        {NULL, 0},    0,  0,  0,  NO_CONDITION},
            };
 
-static RuleList step5b_rules[] =
+static const PorterRule step5b_rules[] =
            {
-             {503,  "ll",        "l",     1,  0,  1,  NULL},
-             {000,  NULL,        NULL,    0,  0,  0,  NULL},
+             {503,  U16("ll"),        U16("l"),     1,  0,  1,  NO_CONDITION},
+             {000,  {NULL, 0},        {NULL, 0},    0,  0,  0,  NO_CONDITION},
            };
 
+/* Steps in the order runSteps() runs them, step1b includes step1b1 */
+static const char *const step_names[] =
+           {
+             "step1a", "step1b", "step1c", "step2", "step3", "step4",
+             "step5a", "step5b",
+           };
+
+#define STEP_COUNT  int(sizeof(step_names) / sizeof(step_names[0]))
+
+#ifdef STEMMER_RULE_STATS
+/* Per rule counters, registered after the tables they point into */
+static RuleStats *rule_stats = CompileRuleStats();
+#endif
+
 
 /*****************************************************************************/
 /********************   Private Function Declarations   **********************/
 
-/*FN***************************************************************************
-
-       WordSize( word )
-
-   Returns: int -- a weird count of word size in adjusted syllables
-
-   Purpose: Count syllables in a special way:  count the number
-            vowel-consonant pairs in a word, disregarding initial
-            consonants and final vowels.  The letter "y" counts as a
-            consonant at the beginning of a word and when it has a vowel
-            in front of it; otherwise (when it follows a consonant) it
-            is treated as a vowel.  For example, the WordSize of "cat"
-            is 1, of "any" is 1, of "amount" is 2, of "anything" is 3.
-
-   Plan:    Run a DFA to compute the word size
-
-   Notes:   The easiest and fastest way to compute this funny measure is
-            with a finite state machine.  The initial state 0 checks
-            the first letter.  If it is a vowel, then the machine changes
-            to state 1, which is the "last letter was a vowel" state.
-            If the first letter is a consonant or y, then it changes
-            to state 2, the "last letter was a consonant state".  In
-            state 1, a y is treated as a consonant (since it follows
-            a vowel), but in state 2, y is treated as a vowel (since
-            it follows a consonant.  The result counter is incremented
-            on the transition from state 1 to state 2, since this
-            transition only occurs after a vowel-consonant pair, which
-            is what we are counting.
+/*FN**************************************************************************
+
+       Tables()
+
+   Returns: const ENTables & -- the step tries
+
+   Purpose: Compile the tries on the first stem instead of before
+            main(), so a program that links the library but never
+            stems English pays nothing.  A function local static is
+            built exactly once even when threads race to it.
 **/
 
-static int WordSize( QString &word )
+static const ENTables &Tables()
 {
-    register int result;   /* WordSize of the word */
-    register int state;    /* current state in machine */
+    static const ENTables tables = {
+               ENEngine::compileRules( step1a_rules ),
+               ENEngine::compileRules( step1b_rules ),
+               ENEngine::compileRules( step1b1_rules ),
+               ENEngine::compileRules( step1c_rules ),
+               ENEngine::compileRules( step2_rules ),
+               ENEngine::compileRules( step3_rules ),
+               ENEngine::compileRules( step4_rules ),
+               ENEngine::compileRules( step5a_rules ),
+               ENEngine::compileRules( step5b_rules ),
+               };
+
+    return tables;
+} /* Tables */
 
-    result = 0;
-    state = 0;
+/*FN**************************************************************************
 
-                 /* Run a DFA to compute the word size */
-    for(int i=0; i<word.length(); i++)
-    {
-        QChar c = word.at(i);
-
-        switch ( state )
-        {
-            case 0: state = (IsVowel(c)) ? 1 : 2;
-                   break;
-            case 1: state = (IsVowel(c)) ? 1 : 2;
-                   if ( 2 == state ) result++;
-                   break;
-            case 2: state = (IsVowel(c) || ('y' == c)) ? 1 : 2;
-                   break;
-        }
-    }
+       IsOneOf( ch, set )
 
+   Returns: int -- TRUE (1) if ch is one of the ASCII letters in set
 
-    return( result );
+   Purpose: Character class test that does not build a QString.
+**/
 
-} /* WordSize */
+static int IsOneOf( QChar ch, const char *set )
+{
+    for(; 0 != *set; set++)
+    {
+        if(ch.unicode() == (ushort)*set)
+            return true;
+    }
+    return false;
+} /* IsOneOf */
 
 
 /*FN**************************************************************************
 
-       ContainsVowel( word )
+       ContainsVowel( ctx )
 
-   Returns: int -- TRUE (1) if the word parameter contains a vowel,
+   Returns: int -- TRUE (1) if the context word contains a vowel,
             FALSE (0) otherwise.
 
    Purpose: Some of the rewrite rules apply only to a root containing
@@ -244,13 +277,23 @@ static int WordSize( QString &word )
    Notes:   None
 **/
 
-static int ContainsVowel( QString &word )
+static int ContainsVowel( PorterContext &ctx )
 {
+    const QChar *word = ctx.word;
 
-    if(word.isEmpty())
+    if(0 == ctx.length)
         return false;
-    else
-        return( IsVowel(word.at(0)) || (NULL != strpbrk(word.toStdString().c_str()+1,"aeiouy")) );
+
+    if(IsVowel(word[0]))
+        return true;
+
+    for(int i=1; i<ctx.length; i++)
+    {
+        if(IsVowel(word[i]) || 'y' == word[i])
+            return true;
+    }
+
+    return false;
 
 
     /*if ( EOS == *word )
@@ -264,7 +307,7 @@ static int ContainsVowel( QString &word )
 
 /*FN**************************************************************************
 
-       EndsWithCVC( word )
+       EndsWithCVC( ctx )
 
    Returns: int -- TRUE (1) if the current word ends with a
             consonant-vowel-consonant combination, and the second
@@ -275,21 +318,25 @@ static int ContainsVowel( QString &word )
 
    Plan:    Look at the last three characters.
 
-   Notes:   None
+   Notes:   Leaves ctx.endIndex pointing at the last character examined,
+            exactly like the global end pointer of the original C code.
+            A two letter word has no third character; the original read
+            the one before the word there, which is never a vowel.
 **/
 
-static int EndsWithCVC( QString &word )
+static int EndsWithCVC( PorterContext &ctx )
 {
-    int length = word.length();         /* for finding the last three characters */
+    const QChar *word = ctx.word;
+    int length = ctx.length;         /* for finding the last three characters */
 
     if ( length < 2 )
         return( false );
     else
     {
-        endIndex = word.length()-1;
-        return( QString("aeiouwxy").contains( word.at(endIndex--) )
-                && QString("aeiouy").contains( word.at(endIndex--) )
-                && QString("aeiou").contains( word.at(endIndex) )
+        ctx.endIndex = length-1;
+        return( IsOneOf( word[ctx.endIndex--], "aeiouwxy" )
+                && IsOneOf( word[ctx.endIndex--], "aeiouy" )
+                && 0 <= ctx.endIndex && IsOneOf( word[ctx.endIndex], "aeiou" )
               );
     }
 
@@ -298,7 +345,7 @@ static int EndsWithCVC( QString &word )
 
 /*FN**************************************************************************
 
-       AddAnE( word )
+       AddAnE( ctx )
 
    Returns: int -- TRUE (1) if the current word meets special conditions
             for adding an e.
@@ -310,15 +357,15 @@ static int EndsWithCVC( QString &word )
    Notes:   None
 **/
 
-static int AddAnE( QString &word )
+static int AddAnE( PorterContext &ctx )
 {
-    return( (1 == WordSize(word)) && EndsWithCVC(word) );
+    return( (1 == ENEngine::wordSize(ctx)) && EndsWithCVC(ctx) );
 } /* AddAnE */
 
 
 /*FN**************************************************************************
 
-       RemoveAnE( word )
+       RemoveAnE( ctx )
 
    Returns: int -- TRUE (1) if the current word meets special conditions
             for removing an e.
@@ -330,70 +377,121 @@ static int AddAnE( QString &word )
    Notes:   None
 **/
 
-static int RemoveAnE( QString &word )
+static int RemoveAnE( PorterContext &ctx )
 {
-    return( (1 == WordSize(word)) && !EndsWithCVC(word) );
+    return( (1 == ENEngine::wordSize(ctx)) && !EndsWithCVC(ctx) );
 } /* RemoveAnE */
 
 
+#ifdef STEMMER_RULE_STATS
 /*FN**************************************************************************
 
-       ReplaceEnd( word, rule )
+       CompileRuleStats()
+
+   Returns: RuleStats * -- counters for every rule of every step table
+
+   Notes:   step1b1 is kept as a table of its own, it only runs after
+            rule 106 or 107 of step1b fired.
+**/
+
+static RuleStats *CompileRuleStats()
+{
+    static const struct { const char *name; const PorterRule *rules; } tables[] =
+           {
+             {"step1a", step1a_rules}, {"step1b", step1b_rules},
+             {"step1b1", step1b1_rules}, {"step1c", step1c_rules},
+             {"step2", step2_rules}, {"step3", step3_rules},
+             {"step4", step4_rules}, {"step5a", step5a_rules},
+             {"step5b", step5b_rules},
+           };
+    RuleStats *stats = new RuleStats;
+
+    for(uint t=0; t<sizeof(tables) / sizeof(tables[0]); t++)
+    {
+        stats->addStep( tables[t].name, tables[t].rules, sizeof(PorterRule) );
+        for(const PorterRule *rule = tables[t].rules; 0 != rule->id; rule++)
+            stats->addRule( rule->id, QString( RuleChars( rule->old_end ), rule->old_end.length ) );
+    }
 
-   Returns: int -- the id for the rule fired, 0 is none is fired
+    return( stats );
+} /* CompileRuleStats */
+#endif
 
-   Purpose: Apply a set of rules to replace the suffix of a word
+/*FN**************************************************************************
+
+       ENLanguage::condition( condition, ctx )
 
-   Plan:    Loop through the rule set until a match meeting all conditions
-            is found.  If a rule fires, return its id, otherwise return 0.
-            Connditions on the length of the root are checked as part of this
-            function's processing because this check is so often made.
+   Returns: int -- TRUE (1) if the word meets the rule condition
 
-   Notes:   This is the main routine driving the stemmer.  It goes through
-            a set of suffix replacement rules looking for a match on the
-            current suffix.  When it finds one, if the root of the word
-            is long enough, and it meets whatever other conditions are
-            required, then the suffix is replaced, and the function returns.
+   Purpose: The condition column of the tables, resolved at compile time
+            instead of through function pointers.
 **/
 
-static int ReplaceEnd( QString &word, RuleList *rule )
+inline int ENLanguage::condition(int condition, PorterContext &ctx)
 {
+    switch ( condition )
+    {
+        case CONTAINS_VOWEL: return( ContainsVowel(ctx) );
+        case ADD_AN_E:       return( AddAnE(ctx) );
+        case REMOVE_AN_E:    return( RemoveAnE(ctx) );
+    }
 
-    int ending;   /* set to start of possible stemmed suffix */
-    QChar tmp_ch;             /* save replaced character when testing */
+    return( false );
+} /* ENLanguage::condition */
 
-    while ( 0 != rule->id )
-    {
-//        qDebug() << "rule ID" << rule->id;
-        ending = endIndex - rule->old_offset;
-        if ( ending >= 0 )
-        {
-//            qDebug() << word.right(word.length() - ending) << rule->old_end;
-            if ( word.right(word.length() - ending) == rule->old_end )
-            {
-//                tmp_ch = word.at(ending);
-//                *ending = EOS;
-
-                if ( rule->min_root_size < WordSize(word) )
-                    if ( !rule->condition || (*rule->condition)(word) )
-                    {
-                        word = word.left( word.length()-rule->old_end.length() );
-                        word.append( rule->new_end );
-//                        (void)strcat( word, rule->new_end );
-                        endIndex = word.length() - 1;
-                        break;
-                    }
-
-//                *ending = tmp_ch;
-            }
-        }
 
-        rule++;
-    }
+/*FN**************************************************************************
 
-    return( rule->id );
+       ENLanguage::runSteps( ctx, steps )
 
-} /* ReplaceEnd */
+   Returns: int -- the length of the stem
+
+   Purpose: Run the Porter algorithm over the measured word in ctx.
+
+   Notes:   Only the first steps entries of step_names are run, so the
+            benchmark can time each step as the difference between two
+            prefixes.  stem() always passes STEP_COUNT.
+**/
+
+int ENLanguage::runSteps(PorterContext &ctx, int steps)
+{
+    int rule;    /* which rule is fired in replacing an end */
+    const ENTables &tables = Tables();
+
+                /*  Part 2: Run through the Porter algorithm */
+    if ( steps < 1 ) return ctx.length;
+    (void)ENEngine::replaceEnd( ctx, step1a_rules, tables.step1a );
+    if ( steps < 2 ) return ctx.length;
+    rule = ENEngine::replaceEnd( ctx, step1b_rules, tables.step1b );
+    if ( (106 == rule) || (107 == rule) )
+      (void)ENEngine::replaceEnd( ctx, step1b1_rules, tables.step1b1 );
+    if ( steps < 3 ) return ctx.length;
+    (void)ENEngine::replaceEnd( ctx, step1c_rules, tables.step1c );
+
+    if ( steps < 4 ) return ctx.length;
+    (void)ENEngine::replaceEnd( ctx, step2_rules, tables.step2 );
+
+    if ( steps < 5 ) return ctx.length;
+    (void)ENEngine::replaceEnd( ctx, step3_rules, tables.step3 );
+
+    if ( steps < 6 ) return ctx.length;
+    (void)ENEngine::replaceEnd( ctx, step4_rules, tables.step4 );
+
+    if ( steps < 7 ) return ctx.length;
+    (void)ENEngine::replaceEnd( ctx, step5a_rules, tables.step5a );
+    if ( steps < 8 ) return ctx.length;
+    (void)ENEngine::replaceEnd( ctx, step5b_rules, tables.step5b );
+
+
+    return ctx.length;
+} /* ENLanguage::runSteps */
+
+#ifdef STEMMER_RULE_STATS
+RuleStats *ENLanguage::ruleStats()
+{
+    return rule_stats;
+}
+#endif
 
 ENPorterStemmer::ENPorterStemmer()
 {
@@ -402,36 +500,102 @@ ENPorterStemmer::ENPorterStemmer()
 
 QString ENPorterStemmer::stem(QString word)
 {
-    int rule;    /* which rule is fired in replacing an end */
+    QString lowered = word;
+    int flags;
 
     /* Part 1: Check to ensure the word is all alphabetic */
-    word = word.toLower();
-    for(int i=0; i<word.length(); i++)
+    flags = LowerWord( lowered.data(), lowered.length() );
+    if(flags & LOWER_OUT_OF_RANGE)
     {
-        if(!word.at(i).isLetter())
-            return word;
+        /* Redo it with the full Unicode case mapping */
+        lowered = word.toLower();
+        for(int i=0; i<lowered.length(); i++)
+        {
+            if(!lowered.at(i).isLetter())
+                return lowered;
+        }
     }
+    else if(!(flags & LOWER_ALPHABETIC))
+        return lowered;
 
-    endIndex = word.length()-1;
+    lowered.truncate( ENEngine::stemInPlace( lowered.data(), lowered.length(), STEP_COUNT ) );
 
-//    qDebug() << word << endIndex << ContainsVowel(word) << WordSize(word);
+    return lowered;
+}
 
-                /*  Part 2: Run through the Porter algorithm */
-    (void)ReplaceEnd( word, step1a_rules );
-    rule = ReplaceEnd( word, step1b_rules );
-    if ( (106 == rule) || (107 == rule) )
-      (void)ReplaceEnd( word, step1b1_rules );
-    (void)ReplaceEnd( word, step1c_rules );
+int ENPorterStemmer::stem(QChar *word, int length)
+{
+    return stemSteps( word, length, STEP_COUNT );
+}
 
-    (void)ReplaceEnd( word, step2_rules );
+int ENPorterStemmer::stemSteps(QChar *word, int length, int steps)
+{
+    /* Part 1: Check to ensure the word is all alphabetic */
+    if(!(LowerWord( word, length ) & LOWER_ALPHABETIC))
+        return length;
 
-    (void)ReplaceEnd( word, step3_rules );
+    return ENEngine::stemInPlace( word, length, steps );
+}
 
-    (void)ReplaceEnd( word, step4_rules );
+int ENPorterStemmer::stepCount()
+{
+    return STEP_COUNT;
+}
 
-    (void)ReplaceEnd( word, step5a_rules );
-    (void)ReplaceEnd( word, step5b_rules );
+const char *ENPorterStemmer::stepName(int step)
+{
+    return (0 <= step && step < STEP_COUNT) ? step_names[step] : NULL;
+}
 
+QVector<RuleCount> ENPorterStemmer::ruleStats()
+{
+#ifdef STEMMER_RULE_STATS
+    return rule_stats->counts();
+#else
+    return QVector<RuleCount>();
+#endif
+}
+
+void ENPorterStemmer::resetRuleStats()
+{
+#ifdef STEMMER_RULE_STATS
+    rule_stats->reset();
+#endif
+}
 
-    return word;
+int ENPorterStemmer::stem(const char *word, int length, char *out, int capacity)
+{
+    QVarLengthArray<QChar, 64> buffer( length );
+    bool alphabetic = true;
+
+    /* Part 1: Lower and widen pure ASCII words, anything else takes the
+       QString path so it gets the full Unicode case mapping */
+    for(int i=0; i<length; i++)
+    {
+        uchar c = word[i];
+        if(c >= 0x80)
+        {
+            QByteArray utf8 = stem( QString::fromUtf8(word, length) ).toUtf8();
+            memcpy( out, utf8.constData(), qMin(utf8.size(), capacity) );
+            return utf8.size();
+        }
+
+        if('A' <= c && c <= 'Z')
+            c += 'a' - 'A';
+        alphabetic = alphabetic && 'a' <= c && c <= 'z';
+        buffer[i] = QChar( c );
+    }
+
+    if(alphabetic)
+        length = ENEngine::stemInPlace( buffer.data(), length, STEP_COUNT );
+
+    for(int i=0; i<qMin(length, capacity); i++)
+        out[i] = buffer[i].toLatin1();
+
+    return length;
+}
+
+QStringList ENPorterStemmer::stemBatch(const QStringList &words)
+{
+    return StemBatch<ENPorterStemmer::stem>( words );
 }
@@ -12,6 +12,9 @@
 #define ENPORTERSTEMMER_H
 
 #include <QString>
+#include <QStringList>
+#include <QVector>
+#include "rulestats.h"
 //#include <QDebug>
 
 class ENPorterStemmer
@@ -19,6 +22,30 @@ class ENPorterStemmer
 public:
     ENPorterStemmer();
     static QString stem(QString word);
+
+    // Stems word[0..length) in place without allocating and returns the
+    // length of the stem. Lowering uses the simple per-character mapping.
+    static int stem(QChar *word, int length);
+
+    // Stems the UTF-8 word[0..length) into out and returns the byte length
+    // of the stem. ASCII words never leave the caller's buffers, others go
+    // through the QString path. Nothing is written past capacity; if the
+    // returned length is larger, call again with a bigger out buffer.
+    static int stem(const char *word, int length, char *out, int capacity);
+
+    static QStringList stemBatch(const QStringList &words);
+
+    // Benchmark hooks: stemSteps() lowers the word like stem() but then
+    // runs only the first steps of the stepCount() steps, in the order
+    // named by stepName().
+    static int stemSteps(QChar *word, int length, int steps);
+    static int stepCount();
+    static const char *stepName(int step);
+
+    // Counters of every rule since start or resetRuleStats(), in table
+    // order. Empty unless built with CONFIG+=stemmer_rule_stats.
+    static QVector<RuleCount> ruleStats();
+    static void resetRuleStats();
 };
 
 #endif // ENPORTERSTEMMER_H
@@ -0,0 +1,271 @@
+/******************************************************************
+
+   Stems a whole file on the thread pool and collects its distinct
+   words as a table model.
+
+   Licensed under GPLv3. See LICENCE.md file
+
+**/
+
+#include "filestemmer.h"
+
+#include <QFile>
+#include <QtConcurrent>
+
+/*****************************************************************************/
+/*****************   Private Defines and Data Structures   *******************/
+
+/* Bytes of the file stemmed by one task, a chunk ends at the first
+   whitespace after this so no word or UTF-8 sequence is split */
+#define FILE_CHUNK  (256 * 1024)
+
+/* A range of the file for one pool task */
+typedef struct {
+           const QByteArray *text;     /* the whole file */
+           int begin;
+           int end;
+           TextAnalyzer::StemFunction stemFunction;
+           } FileChunk;
+
+/*****************************************************************************/
+/********************   Private Function Declarations   **********************/
+static QVector<FileChunk> SplitChunks( const QByteArray &text, TextAnalyzer::StemFunction stemFunction );
+static FileStems StemChunk( const FileChunk &chunk );
+
+
+/*FN**************************************************************************
+
+       SplitChunks( text, stemFunction )
+
+   Returns: QVector<FileChunk> -- ranges covering the whole text
+
+   Notes:   Only the bytes around each cut are looked at, so splitting
+            costs next to nothing even for a big file.
+**/
+
+static QVector<FileChunk> SplitChunks( const QByteArray &text, TextAnalyzer::StemFunction stemFunction )
+{
+    QVector<FileChunk> chunks;
+    const char *data = text.constData();
+    int begin = 0;
+
+    while(begin < text.size())
+    {
+        int end = text.size() - begin > FILE_CHUNK ? begin + FILE_CHUNK : text.size();
+        while(end < text.size() && ' ' != data[end] && '\n' != data[end] && '\t' != data[end] && '\r' != data[end])
+            end++;
+
+        FileChunk chunk = { &text, begin, end, stemFunction };
+        chunks.append( chunk );
+        begin = end;
+    }
+
+    return chunks;
+} /* SplitChunks */
+
+
+/*FN**************************************************************************
+
+       StemChunk( chunk )
+
+   Returns: FileStems -- distinct words of the chunk and their stems
+
+   Purpose: Runs on a pool thread.  Each distinct word is copied out of
+            the text once; repeats are found by a lookup that does not
+            allocate.
+**/
+
+static FileStems StemChunk( const FileChunk &chunk )
+{
+    FileStems result;
+    QString text = QString::fromUtf8( chunk.text->constData() + chunk.begin, chunk.end - chunk.begin );
+    TextAnalyzer analyzer( chunk.stemFunction );
+    QHash<QString, int> index;
+
+    int n = analyzer.analyze( text );
+    for(int i=0; i<n; i++)
+    {
+        const AnalyzedToken &token = analyzer.token(i);
+        QHash<QString, int>::const_iterator it = index.constFind( QString::fromRawData( text.constData() + token.start, token.length ) );
+        if(it != index.constEnd())
+        {
+            result.counts[it.value()]++;
+            continue;
+        }
+
+        QString word( text.constData() + token.start, token.length );
+        index.insert( word, result.words.size() );
+        result.words.append( word );
+        result.stems.append( QString( analyzer.stemChars( token ), token.stemLength ) );
+        result.counts.append( 1 );
+    }
+    result.tokens = n;
+
+    return result;
+} /* StemChunk */
+
+
+FileStemmer::FileStemmer(QObject *parent) :
+    QAbstractTableModel(parent),
+    chunkCount(0),
+    tokens(0),
+    elapsedMs(0)
+{
+    connect(&watcher, SIGNAL(resultReadyAt(int)), this, SLOT(addChunk(int)));
+    connect(&watcher, SIGNAL(progressValueChanged(int)), this, SLOT(chunkDone(int)));
+    connect(&watcher, SIGNAL(finished()), this, SLOT(runFinished()));
+}
+
+FileStemmer::~FileStemmer()
+{
+    watcher.cancel();
+    watcher.waitForFinished();
+}
+
+
+/*FN**************************************************************************
+
+       start( fileName, stemFunction, error )
+
+   Returns: bool -- false if the file cannot be read
+
+   Purpose: Split the file into chunks and hand them to the global
+            thread pool.  Results come back through the watcher as
+            queued signals, so the table only changes on the thread
+            that owns it.
+**/
+
+bool FileStemmer::start(const QString &fileName, TextAnalyzer::StemFunction stemFunction, QString *error)
+{
+    QFile file( fileName );
+    if(!file.open( QIODevice::ReadOnly ))
+    {
+        *error = fileName + ": " + file.errorString();
+        return false;
+    }
+
+    // chunks of the last run read text until it has stopped
+    cancel();
+    watcher.waitForFinished();
+
+    beginResetModel();
+    rows.clear();
+    rowOf.clear();
+    tokens = 0;
+    elapsedMs = 0;
+    endResetModel();
+
+    text = file.readAll();
+    QVector<FileChunk> chunks = SplitChunks( text, stemFunction );
+    chunkCount = chunks.size();
+    emit progressChanged( 0, chunkCount );
+
+    timer.start();
+    watcher.setFuture( QtConcurrent::mapped( chunks, StemChunk ) );
+
+    return true;
+}
+
+void FileStemmer::cancel()
+{
+    watcher.cancel();
+}
+
+void FileStemmer::addChunk(int chunk)
+{
+    FileStems stems = watcher.resultAt( chunk );
+    int first = rows.size();
+    int added = 0;
+
+    // count the new words first so the view gets one insertion per chunk
+    for(int i=0; i<stems.words.size(); i++)
+    {
+        if(!rowOf.contains( stems.words.at(i) ))
+            added++;
+    }
+
+    if(added > 0)
+        beginInsertRows( QModelIndex(), first, first + added - 1 );
+    for(int i=0; i<stems.words.size(); i++)
+    {
+        QHash<QString, int>::iterator it = rowOf.find( stems.words.at(i) );
+        if(it != rowOf.end())
+        {
+            rows[it.value()].count += stems.counts.at(i);
+            continue;
+        }
+
+        Row row = { stems.words.at(i), stems.stems.at(i), stems.counts.at(i) };
+        rowOf.insert( row.word, rows.size() );
+        rows.append( row );
+    }
+    if(added > 0)
+        endInsertRows();
+
+    tokens += stems.tokens;
+    if(first > 0)
+        emit dataChanged( index( 0, COLUMN_COUNT ), index( first - 1, COLUMN_COUNT ) );
+}
+
+void FileStemmer::chunkDone(int chunksDone)
+{
+    emit progressChanged( chunksDone, chunkCount );
+}
+
+void FileStemmer::runFinished()
+{
+    elapsedMs = timer.elapsed();
+    emit finished( watcher.isCanceled() );
+}
+
+int FileStemmer::rowCount(const QModelIndex &parent) const
+{
+    return parent.isValid() ? 0 : rows.size();
+}
+
+int FileStemmer::columnCount(const QModelIndex &parent) const
+{
+    return parent.isValid() ? 0 : COLUMN_END;
+}
+
+QVariant FileStemmer::data(const QModelIndex &index, int role) const
+{
+    if(!index.isValid() || index.row() >= rows.size())
+        return QVariant();
+
+    const Row &row = rows.at( index.row() );
+    if(Qt::DisplayRole == role)
+    {
+        switch (index.column()) {
+        case COLUMN_WORD:
+            return row.word;
+        case COLUMN_STEM:
+            return row.stem;
+        case COLUMN_COUNT:
+            return row.count;
+        default:
+            break;
+        }
+    }
+    else if(Qt::TextAlignmentRole == role && COLUMN_COUNT == index.column())
+        return int(Qt::AlignRight | Qt::AlignVCenter);
+
+    return QVariant();
+}
+
+QVariant FileStemmer::headerData(int section, Qt::Orientation orientation, int role) const
+{
+    if(Qt::Horizontal != orientation || Qt::DisplayRole != role)
+        return QAbstractTableModel::headerData( section, orientation, role );
+
+    switch (section) {
+    case COLUMN_WORD:
+        return tr("Word");
+    case COLUMN_STEM:
+        return tr("Stem");
+    case COLUMN_COUNT:
+        return tr("Count");
+    default:
+        return QVariant();
+    }
+}
@@ -0,0 +1,86 @@
+/******************************************************************
+
+   Stems a whole file on the thread pool and collects its distinct
+   words as a table model, filled in chunk by chunk while the rest
+   of the file is still being stemmed.
+
+   Licensed under GPLv3. See LICENCE.md file
+
+**/
+
+#ifndef FILESTEMMER_H
+#define FILESTEMMER_H
+
+#include <QAbstractTableModel>
+#include <QByteArray>
+#include <QElapsedTimer>
+#include <QFutureWatcher>
+#include <QHash>
+#include <QString>
+#include <QVector>
+
+#include "textanalyzer.h"
+
+/* Distinct words of one chunk of the file, with their stems */
+typedef struct {
+           QVector<QString> words;
+           QVector<QString> stems;     /* empty for a stop word */
+           QVector<quint32> counts;    /* occurrences of words[i] in the chunk */
+           quint64 tokens;             /* words in the chunk */
+           } FileStems;
+
+class FileStemmer : public QAbstractTableModel
+{
+    Q_OBJECT
+
+public:
+    enum COLUMN {COLUMN_WORD, COLUMN_STEM, COLUMN_COUNT, COLUMN_END};
+
+    explicit FileStemmer(QObject *parent = 0);
+    ~FileStemmer();
+
+    // Clears the table and starts stemming the UTF-8 file, false with
+    // *error set if it cannot be read. A run still going is canceled.
+    bool start(const QString &fileName, TextAnalyzer::StemFunction stemFunction, QString *error);
+    bool isRunning() const { return watcher.isRunning(); }
+
+    quint64 tokenCount() const { return tokens; }
+    qint64 elapsed() const { return elapsedMs; }
+
+    int rowCount(const QModelIndex &parent = QModelIndex()) const;
+    int columnCount(const QModelIndex &parent = QModelIndex()) const;
+    QVariant data(const QModelIndex &index, int role = Qt::DisplayRole) const;
+    QVariant headerData(int section, Qt::Orientation orientation, int role = Qt::DisplayRole) const;
+
+public slots:
+    // Chunks not started are dropped, finished() follows once the
+    // running ones are done.
+    void cancel();
+
+signals:
+    void progressChanged(int chunksDone, int chunkCount);
+    void finished(bool canceled);
+
+private slots:
+    void addChunk(int chunk);
+    void chunkDone(int chunksDone);
+    void runFinished();
+
+private:
+    typedef struct {
+               QString word;
+               QString stem;
+               quint64 count;
+               } Row;
+
+    QFutureWatcher<FileStems> watcher;
+    QByteArray text;                   /* the file, chunks point into it */
+    int chunkCount;
+    QVector<Row> rows;                 /* in the order words were first added */
+    QHash<QString, int> rowOf;         /* word -> index in rows */
+    quint64 tokens;
+    QElapsedTimer timer;
+    qint64 elapsedMs;
+};
+
+#endif // FILESTEMMER_H
@@ -0,0 +1,158 @@
+/******************************************************************
+
+   Pieces shared by the flat binary images of the library: compiled
+   rule sets, stem dictionaries and index segments.
+
+   Licensed under GPLv3. See LICENCE.md file
+
+**/
+
+#include "imageformat.h"
+
+#include <string.h>
+
+
+MappedImage::MappedImage()
+    : start( NULL ), length( 0 )
+{
+}
+
+bool MappedImage::map(const QString &fileName, QString *error)
+{
+    bytes.clear();
+    file.close();
+    file.setFileName( fileName );
+    start = NULL;
+    length = 0;
+
+    if(!file.open( QIODevice::ReadOnly ))
+    {
+        *error = fileName + ": " + file.errorString();
+        return false;
+    }
+
+    const uchar *image = file.size() > 0 ? file.map( 0, file.size() ) : NULL;
+    if(NULL == image)
+    {
+        *error = fileName + ": cannot map the file";
+        return false;
+    }
+
+    start = image;
+    length = file.size();
+    return true;
+}
+
+void MappedImage::setImage(const QByteArray &image)
+{
+    file.close();
+    bytes = image;
+    start = reinterpret_cast<const uchar *>( bytes.constData() );
+    length = bytes.size();
+}
+
+
+/*FN**************************************************************************
+
+       AppendSection( image, data, size )
+
+   Returns: quint32 -- offset of the appended data
+
+   Purpose: Add a section to the image, every section starts 4 byte
+            aligned.
+**/
+
+quint32 AppendSection(QByteArray &image, const void *data, int size)
+{
+    while(0 != image.size() % 4)
+        image.append( '\0' );
+
+    quint32 offset = image.size();
+    image.append( static_cast<const char *>( data ), size );
+
+    return offset;
+} /* AppendSection */
+
+/* 7 bits per byte, low bits first, the high bit set on all but the last */
+void PutVarint(QByteArray &out, quint32 value)
+{
+    while(value >= 0x80)
+    {
+        out.append( char(value | 0x80) );
+        value >>= 7;
+    }
+    out.append( char(value) );
+} /* PutVarint */
+
+
+/*FN**************************************************************************
+
+       GetVarint( p, end, value )
+
+   Returns: const uchar * -- first byte after the varint, NULL if it runs
+                             past end or is longer than a quint32 needs
+
+   Purpose: Read back what PutVarint() wrote.
+**/
+
+const uchar *GetVarint(const uchar *p, const uchar *end, quint32 *value)
+{
+    *value = 0;
+
+    for(int shift=0; shift<35 && p<end; shift+=7)
+    {
+        *value |= quint32(*p & 0x7f) << shift;
+        if(0 == (*p++ & 0x80))
+            return p;
+    }
+
+    return NULL;
+} /* GetVarint */
+
+
+/*FN**************************************************************************
+
+       CheckImageHeader( image, size, headerSize, magic, version, format,
+                         error )
+
+   Returns: bool -- false if the image is not of the format, with error
+                    set to why
+
+   Purpose: The checks every image starts with: room for the header,
+            alignment, magic, version and size.  format names the kind
+            of image in the messages, such as "stem dictionary".
+**/
+
+bool CheckImageHeader(const uchar *image, qint64 size, int headerSize, quint32 magic,
+                      quint32 version, const char *format, QString *error)
+{
+    const ImageHeader *head = reinterpret_cast<const ImageHeader *>( image );
+    QString name = QString::fromLatin1( format );
+    QString article = NULL != strchr( "aeiou", format[0] ) ? "an " : "a ";
+
+    if(NULL == image || size < headerSize || 0 != (quintptr(image) & 3))
+        *error = "not " + article + name;
+    else if(magic != head->magic)
+        *error = "not " + article + name + ", or built on a machine of other byte order";
+    else if(version != head->version)
+        *error = QString( "%1 version %2, expected %3" ).arg( name ).arg( head->version ).arg( version );
+    else if(head->size != size)
+        *error = name + " is truncated";
+    else
+        return true;
+
+    return false;
+} /* CheckImageHeader */
+
+/* True if every section lies in an image of size bytes and is aligned */
+bool SectionsFit(const ImageSection *sections, int count, qint64 size)
+{
+    for(int i=0; i<count; i++)
+    {
+        if(0 != sections[i].offset % 4 || sections[i].offset > size
+                || quint64(sections[i].count) * sections[i].unit > quint64(size - sections[i].offset))
+            return false;
+    }
+
+    return true;
+} /* SectionsFit */
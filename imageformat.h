@@ -0,0 +1,67 @@
+/******************************************************************
+
+   Pieces shared by the flat binary images of the library: compiled
+   rule sets, stem dictionaries and index segments.  Every image
+   starts with an ImageHeader, is laid out in 4 byte aligned sections
+   and is either memory mapped from a file or held in memory.
+
+   Licensed under GPLv3. See LICENCE.md file
+
+**/
+
+#ifndef IMAGEFORMAT_H
+#define IMAGEFORMAT_H
+
+#include <QByteArray>
+#include <QFile>
+#include <QString>
+
+/* First fields of the header of every image */
+typedef struct {
+           quint32 magic;          /* tells the formats and byte orders apart */
+           quint32 version;
+           quint32 size;           /* bytes in the whole image */
+           } ImageHeader;
+
+/* An array in an image, for SectionsFit() */
+typedef struct {
+           quint32 offset;         /* from the start of the image */
+           quint32 count;          /* elements */
+           quint32 unit;           /* bytes per element */
+           } ImageSection;
+
+/* The bytes of an image, from a mapped file or a QByteArray */
+class MappedImage
+{
+public:
+    MappedImage();
+
+    // Maps the whole file read only. On failure error is set to the file
+    // name and the reason, and data() is NULL.
+    bool map(const QString &fileName, QString *error);
+
+    // Holds image instead of a file.
+    void setImage(const QByteArray &image);
+
+    const uchar *data() const { return start; }
+    qint64 size() const { return length; }
+
+private:
+    Q_DISABLE_COPY(MappedImage)
+
+    QFile file;                     /* mapped image of map() */
+    QByteArray bytes;               /* image of setImage() */
+    const uchar *start;
+    qint64 length;
+};
+
+quint32 AppendSection(QByteArray &image, const void *data, int size);
+
+void PutVarint(QByteArray &out, quint32 value);
+const uchar *GetVarint(const uchar *p, const uchar *end, quint32 *value);
+
+bool CheckImageHeader(const uchar *image, qint64 size, int headerSize, quint32 magic,
+                      quint32 version, const char *format, QString *error);
+bool SectionsFit(const ImageSection *sections, int count, qint64 size);
+
+#endif // IMAGEFORMAT_H
@@ -0,0 +1,17 @@
+#-------------------------------------------------
+#
+# Builds, merges and queries inverted index segments
+#
+#-------------------------------------------------
+
+QT       += core
+QT       -= gui
+
+TARGET = QtPorterStemmerIndex
+CONFIG   += console
+CONFIG   -= app_bundle
+TEMPLATE = app
+
+include(../stemmer.pri)
+
+SOURCES += main.cpp
@@ -0,0 +1,153 @@
+/******************************************************************
+
+   Index tool: builds an inverted index segment of files, one document
+   per file, merges segments, and runs stemmed queries against them.
+
+   Licensed under GPLv3. See LICENCE.md file
+
+**/
+
+#include <QCoreApplication>
+#include <QCommandLineParser>
+#include <QFile>
+
+#include <algorithm>
+#include <stdio.h>
+
+#include "invertedindex.h"
+
+static bool ByFrequency(const Posting &a, const Posting &b)
+{
+    if(a.frequency != b.frequency)
+        return a.frequency > b.frequency;
+    return a.doc < b.doc;
+}
+
+static bool WriteImage(const QString &name, const QByteArray &image)
+{
+    QFile out( name );
+
+    if(!out.open( QIODevice::WriteOnly ) || out.write( image ) != image.size() || !out.flush())
+    {
+        fprintf( stderr, "%s: %s\n", qPrintable(name), qPrintable(out.errorString()) );
+        return false;
+    }
+
+    return true;
+}
+
+/*FN**************************************************************************
+
+       Query( lang, query, files )
+
+   Returns: int -- process exit code
+
+   Purpose: Print "frequency<TAB>document" for every document matching
+            the query, most occurrences first.
+**/
+
+static int Query(const QString &lang, const QString &query, const QStringList &files)
+{
+    InvertedIndex index( lang );
+
+    foreach(const QString &name, files)
+    {
+        if(!index.addSegment( name ))
+        {
+            fprintf( stderr, "%s\n", qPrintable(index.errorString()) );
+            return 1;
+        }
+    }
+
+    QVector<Posting> hits = index.search( query );
+    std::sort( hits.begin(), hits.end(), ByFrequency );
+    for(int i=0; i<hits.size(); i++)
+        printf( "%u\t%s\n", hits.at(i).frequency, qPrintable(index.documentName( hits.at(i).doc )) );
+
+    return 0;
+}
+
+static int Merge(const QStringList &files, const QString &output)
+{
+    QVector<IndexSegment *> segments;
+    QVector<const IndexSegment *> loaded;
+    int result = 0;
+
+    foreach(const QString &name, files)
+    {
+        segments.append( new IndexSegment );
+        if(!segments.last()->load( name ))
+        {
+            fprintf( stderr, "%s\n", qPrintable(segments.last()->errorString()) );
+            result = 1;
+        }
+        loaded.append( segments.last() );
+    }
+
+    if(0 == result)
+    {
+        QString error;
+        QByteArray image = IndexSegment::merge( loaded, &error );
+        if(image.isEmpty())
+        {
+            fprintf( stderr, "%s\n", qPrintable(error) );
+            result = 1;
+        }
+        else if(!WriteImage( output, image ))
+            result = 1;
+    }
+
+    qDeleteAll( segments );
+    return result;
+}
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication a(argc, argv);
+    QCoreApplication::setApplicationName( "QtPorterStemmerIndex" );
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription( "Builds an inverted index segment of UTF-8 files, merges segments or queries them." );
+    parser.addHelpOption();
+    QCommandLineOption langOption( QStringList() << "l" << "lang", "Stemmer language, lv or en (default lv).", "lang", "lv" );
+    QCommandLineOption outputOption( QStringList() << "o" << "output", "Segment to write.", "file" );
+    QCommandLineOption threadsOption( QStringList() << "j" << "threads", "Worker threads, 0 for one per core (default 0).", "n", "0" );
+    QCommandLineOption baseOption( "base", "Id of the first document (default 0).", "id", "0" );
+    QCommandLineOption mergeOption( QStringList() << "m" << "merge", "Merge the segments given as files into the output." );
+    QCommandLineOption queryOption( QStringList() << "q" << "query", "Search the segments given as files.", "text" );
+    parser.addOption( langOption );
+    parser.addOption( outputOption );
+    parser.addOption( threadsOption );
+    parser.addOption( baseOption );
+    parser.addOption( mergeOption );
+    parser.addOption( queryOption );
+    parser.addPositionalArgument( "files", "Documents to index, or segments to merge or query.", "files..." );
+    parser.process( a );
+
+    QStringList files = parser.positionalArguments();
+    if(files.isEmpty())
+        parser.showHelp( 1 );
+
+    if(parser.isSet( queryOption ))
+        return Query( parser.value( langOption ), parser.value( queryOption ), files );
+
+    if(!parser.isSet( outputOption ))
+    {
+        fprintf( stderr, "-o is required\n" );
+        return 1;
+    }
+
+    if(parser.isSet( mergeOption ))
+        return Merge( files, parser.value( outputOption ) );
+
+    QString error;
+    QByteArray image = InvertedIndex::build( parser.value( langOption ), files, QStringList(),
+                                             parser.value( baseOption ).toUInt(), parser.value( threadsOption ).toInt(), &error );
+    if(image.isEmpty())
+    {
+        fprintf( stderr, "%s\n", qPrintable(error) );
+        return 1;
+    }
+
+    return WriteImage( parser.value( outputOption ), image ) ? 0 : 1;
+}
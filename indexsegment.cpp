@@ -0,0 +1,484 @@
+/******************************************************************
+
+   One segment of an inverted index of stems: a flat image that is
+   written once, memory mapped and read in place, and merged with
+   other segments into a bigger one.
+
+   Licensed under GPLv3. See LICENCE.md file
+
+**/
+
+#include "indexsegment.h"
+
+#include <QMap>
+
+#include <algorithm>
+#include <string.h>
+
+/*****************************************************************************/
+/*****************   Private Defines and Data Structures   *******************/
+
+/* Terms of a segment being laid out, in the order of their UTF-8 bytes */
+typedef QMap<QByteArray, QVector<Posting> > SortedTerms;
+
+/*****************************************************************************/
+/********************   Private Function Declarations   **********************/
+static QByteArray LayOut( const QString &language, quint32 docBase, const QVector<QString> &names, const SortedTerms &terms );
+static bool ByDocBase( const IndexSegment *a, const IndexSegment *b );
+
+
+/*FN**************************************************************************
+
+       LayOut( language, docBase, names, terms )
+
+   Returns: QByteArray -- the segment image
+
+   Purpose: Write the sections of a segment, shared by SegmentWriter and
+            merge().  Posting lists must be in ascending document order.
+**/
+
+static QByteArray LayOut( const QString &language, quint32 docBase, const QVector<QString> &names, const SortedTerms &terms )
+{
+    QVector<SegmentTerm> table;
+    QByteArray text;
+    QByteArray postings;
+    table.reserve( terms.size() );
+
+    SortedTerms::const_iterator it;
+    for(it=terms.constBegin(); it!=terms.constEnd(); ++it)
+    {
+        SegmentTerm term;
+        term.text = text.size();
+        term.textLength = it.key().size();
+        term.docFreq = it.value().size();
+        term.postings = postings.size();
+        text.append( it.key() );
+
+        quint32 previous = docBase;
+        for(int i=0; i<it.value().size(); i++)
+        {
+            PutVarint( postings, it.value().at(i).doc - previous );
+            PutVarint( postings, it.value().at(i).frequency );
+            previous = it.value().at(i).doc;
+        }
+        term.postingsSize = postings.size() - term.postings;
+        table.append( term );
+    }
+
+    QVector<quint32> docs;
+    QByteArray namePool;
+    for(int i=0; i<names.size(); i++)
+    {
+        docs.append( namePool.size() );
+        namePool.append( names.at(i).toUtf8() );
+        namePool.append( '\0' );
+    }
+
+    SegmentHeader header;
+    QByteArray image;
+    memset( &header, 0, sizeof(header) );
+    AppendSection( image, &header, sizeof(header) );
+    header.magic = INDEX_SEGMENT_MAGIC;
+    header.version = INDEX_SEGMENT_VERSION;
+    QByteArray tag = language.toLatin1().left( 3 );
+    memcpy( header.language, tag.constData(), tag.size() );
+    header.docBase = docBase;
+    header.docCount = names.size();
+    header.terms = AppendSection( image, table.constData(), table.size() * sizeof(SegmentTerm) );
+    header.termCount = table.size();
+    header.text = AppendSection( image, text.constData(), text.size() );
+    header.textSize = text.size();
+    header.postings = AppendSection( image, postings.constData(), postings.size() );
+    header.postingsSize = postings.size();
+    header.docs = AppendSection( image, docs.constData(), docs.size() * sizeof(quint32) );
+    header.names = AppendSection( image, namePool.constData(), namePool.size() );
+    header.namesSize = namePool.size();
+    while(0 != image.size() % 4)
+        image.append( '\0' );
+    header.size = image.size();
+    memcpy( image.data(), &header, sizeof(header) );
+
+    return image;
+} /* LayOut */
+
+
+static bool ByDocBase( const IndexSegment *a, const IndexSegment *b )
+{
+    return a->docBase() < b->docBase();
+}
+
+
+SegmentWriter::SegmentWriter(TextAnalyzer::StemFunction stemFunction, const QString &language, quint32 docBase,
+                             StemInterner *stems)
+    : analyzer( stemFunction ), language( language ), docBase( docBase ), stems( stems ), ownStems( NULL == stems )
+{
+    if(ownStems)
+        this->stems = new StemInterner( NULL, 1 );
+}
+
+SegmentWriter::~SegmentWriter()
+{
+    if(ownStems)
+        delete stems;
+}
+
+
+/*FN**************************************************************************
+
+       addDocument( name, text )
+
+   Returns: quint32 -- id of the document
+
+   Purpose: Count the stems of the text and add the document to the
+            posting list of each.  Stop words stem to nothing and are
+            not indexed.
+
+   Plan:    Stems are counted by interned id in arrays kept between
+            documents; seen lists the ids to post and to clear again.
+            With a shared interner the ids are those of the whole
+            index, so the arrays span ids of other writers' stems too.
+**/
+
+quint32 SegmentWriter::addDocument(const QString &name, const QString &text)
+{
+    quint32 doc = docBase + names.size();
+
+    int n = analyzer.analyze( text );
+    for(int i=0; i<n; i++)
+    {
+        const AnalyzedToken &token = analyzer.token(i);
+        if(token.stemLength <= 0)
+            continue;
+
+        quint32 id = stems->intern( analyzer.stemChars( token ), token.stemLength );
+        if(id >= quint32(counts.size()))
+            counts.resize( qMax( int(id) + 1, 2 * counts.size() ) );
+        if(0 == counts[id]++)
+            seen.append( id );
+    }
+
+    if(postings.size() < counts.size())
+        postings.resize( counts.size() );
+    for(int i=0; i<seen.size(); i++)
+    {
+        Posting posting = { doc, counts.at( seen.at(i) ) };
+        postings[seen.at(i)].append( posting );
+        counts[seen.at(i)] = 0;
+    }
+    seen.clear();
+
+    names.append( name );
+    return doc;
+} /* addDocument */
+
+QByteArray SegmentWriter::image() const
+{
+    SortedTerms terms;
+
+    for(int id=0; id<postings.size(); id++)
+    {
+        if(!postings.at(id).isEmpty())
+            terms.insert( stems->string( id ).toUtf8(), postings.at(id) );
+    }
+
+    return LayOut( language, docBase, names, terms );
+}
+
+
+IndexSegment::IndexSegment()
+    : header( NULL )
+{
+}
+
+/*FN**************************************************************************
+
+       load( fileName )
+
+   Returns: bool -- false if the file cannot be mapped or is no valid
+                    segment
+
+   Purpose: Map a segment.  Only the header is checked, the pages of a
+            posting list are read in when a query first needs it.
+**/
+
+bool IndexSegment::load(const QString &fileName)
+{
+    header = NULL;
+    if(!mapped.map( fileName, &error ))
+        return false;
+
+    if(!attach( mapped.data(), mapped.size() ))
+        return fail( fileName + ": " + error );
+
+    return true;
+} /* load */
+
+bool IndexSegment::setImage(const QByteArray &image)
+{
+    header = NULL;
+    mapped.setImage( image );
+
+    return attach( mapped.data(), mapped.size() );
+}
+
+bool IndexSegment::fail(const QString &message)
+{
+    header = NULL;
+    error = message;
+    return false;
+}
+
+
+/*FN**************************************************************************
+
+       attach( image, size )
+
+   Returns: bool -- false if the image is not a valid segment
+
+   Purpose: Check the header and that every section lies in the image.
+
+   Notes:   Terms and posting lists are checked when they are read, so
+            attaching does not walk the whole file.
+**/
+
+bool IndexSegment::attach(const uchar *image, qint64 size)
+{
+    const SegmentHeader *head = reinterpret_cast<const SegmentHeader *>( image );
+
+    if(!CheckImageHeader( image, size, sizeof(SegmentHeader), INDEX_SEGMENT_MAGIC,
+                          INDEX_SEGMENT_VERSION, "index segment", &error ))
+        return false;
+    if(0 != head->language[3])
+        return fail( "index segment language is not terminated" );
+    if(head->docCount > 0xffffffffu - head->docBase)
+        return fail( "index segment document ids overflow" );
+
+    ImageSection sections[] =
+           {
+             { head->terms, head->termCount, sizeof(SegmentTerm) },
+             { head->text, head->textSize, 1 },
+             { head->postings, head->postingsSize, 1 },
+             { head->docs, head->docCount, sizeof(quint32) },
+             { head->names, head->namesSize, 1 },
+           };
+    if(!SectionsFit( sections, int(sizeof(sections) / sizeof(sections[0])), size ))
+        return fail( "index segment section out of range" );
+
+    names = reinterpret_cast<const char *>( image + head->names );
+    if(head->docCount > 0 && (0 == head->namesSize || 0 != names[head->namesSize - 1]))
+        return fail( "index segment names are not terminated" );
+
+    terms = reinterpret_cast<const SegmentTerm *>( image + head->terms );
+    text = reinterpret_cast<const char *>( image + head->text );
+    postingData = image + head->postings;
+    docs = reinterpret_cast<const quint32 *>( image + head->docs );
+    header = head;
+    error.clear();
+
+    return true;
+} /* attach */
+
+QString IndexSegment::language() const
+{
+    return NULL == header ? QString() : QString::fromLatin1( header->language );
+}
+
+QString IndexSegment::documentName(quint32 doc) const
+{
+    if(NULL == header || doc < header->docBase || doc - header->docBase >= header->docCount)
+        return QString();
+
+    quint32 offset = docs[doc - header->docBase];
+    return offset < header->namesSize ? QString::fromUtf8( names + offset ) : QString();
+}
+
+QString IndexSegment::term(int i) const
+{
+    if(NULL == header || i < 0 || quint32(i) >= header->termCount)
+        return QString();
+
+    const SegmentTerm &t = terms[i];
+    if(t.text > header->textSize || t.textLength > header->textSize - t.text)
+        return QString();
+
+    return QString::fromUtf8( text + t.text, t.textLength );
+}
+
+
+/*FN**************************************************************************
+
+       postings( i )
+
+   Returns: QVector<Posting> -- documents of term i in ascending order
+
+   Notes:   A damaged list is cut at the first posting that does not
+            decode or falls outside the segment's documents.
+**/
+
+QVector<Posting> IndexSegment::postings(int i) const
+{
+    QVector<Posting> list;
+    if(NULL == header || i < 0 || quint32(i) >= header->termCount)
+        return list;
+
+    const SegmentTerm &t = terms[i];
+    if(t.postings > header->postingsSize || t.postingsSize > header->postingsSize - t.postings)
+        return list;
+
+    const uchar *p = postingData + t.postings;
+    const uchar *end = p + t.postingsSize;
+    quint64 doc = header->docBase;
+    quint64 docEnd = quint64(header->docBase) + header->docCount;
+
+    list.reserve( qMin( t.docFreq, t.postingsSize / 2 ) );
+    while(p < end)
+    {
+        quint32 delta, frequency;
+        p = GetVarint( p, end, &delta );
+        if(NULL != p)
+            p = GetVarint( p, end, &frequency );
+        if(NULL == p || doc + delta >= docEnd)
+            break;
+
+        doc += delta;
+        Posting posting = { quint32(doc), frequency };
+        list.append( posting );
+    }
+
+    return list;
+} /* postings */
+
+
+/*FN**************************************************************************
+
+       findTerm( stem )
+
+   Returns: int -- index of the term, -1 if the segment does not have it
+
+   Purpose: Binary search of the term table by UTF-8 bytes.
+**/
+
+int IndexSegment::findTerm(const QString &stem) const
+{
+    if(NULL == header)
+        return -1;
+
+    QByteArray key = stem.toUtf8();
+    int low = 0;
+    int high = int(header->termCount) - 1;
+
+    while(low <= high)
+    {
+        int middle = low + (high - low) / 2;
+        const SegmentTerm &t = terms[middle];
+        if(t.text > header->textSize || t.textLength > header->textSize - t.text)
+            return -1;
+
+        int common = qMin( int(t.textLength), key.size() );
+        int order = memcmp( text + t.text, key.constData(), common );
+        if(0 == order)
+            order = int(t.textLength) - key.size();
+
+        if(order < 0)
+            low = middle + 1;
+        else if(order > 0)
+            high = middle - 1;
+        else
+            return middle;
+    }
+
+    return -1;
+} /* findTerm */
+
+
+bool IndexSegment::overlaps(const IndexSegment &other) const
+{
+    if(0 == docCount() || 0 == other.docCount())
+        return false;
+
+    return docBase() >= other.docBase() ? docBase() - other.docBase() < other.docCount()
+                                        : other.docBase() - docBase() < docCount();
+}
+
+
+/*FN**************************************************************************
+
+       merge( segments, error )
+
+   Returns: QByteArray -- the merged image, empty on failure with the
+                          reason in *error
+
+   Purpose: Combine segments, for example those built in parallel or
+            over time, into one.
+
+   Plan:    Take the segments in document order; then every posting
+            list of a term is the lists of the segments one after the
+            other, already ascending.  Ids between the segments that no
+            segment has become documents without a name.
+**/
+
+QByteArray IndexSegment::merge(const QVector<const IndexSegment *> &segments, QString *error)
+{
+    QVector<const IndexSegment *> ordered;
+    foreach(const IndexSegment *segment, segments)
+    {
+        if(NULL == segment || !segment->isValid())
+        {
+            *error = "cannot merge a segment that is not loaded";
+            return QByteArray();
+        }
+        if(0 != segment->docCount())
+            ordered.append( segment );
+    }
+    if(segments.isEmpty())
+    {
+        *error = "no segments to merge";
+        return QByteArray();
+    }
+
+    QString language = segments.first()->language();
+    foreach(const IndexSegment *segment, segments)
+    {
+        if(segment->language() != language)
+        {
+            *error = QString( "cannot merge %1 and %2 segments" ).arg( language ).arg( segment->language() );
+            return QByteArray();
+        }
+    }
+
+    std::sort( ordered.begin(), ordered.end(), ByDocBase );
+    for(int i=1; i<ordered.size(); i++)
+    {
+        if(ordered.at(i)->overlaps( *ordered.at(i-1) ))
+        {
+            *error = "segments have overlapping document ids";
+            return QByteArray();
+        }
+    }
+
+    quint32 docBase = ordered.isEmpty() ? segments.first()->docBase() : ordered.first()->docBase();
+    if(!ordered.isEmpty() && quint64(ordered.last()->docBase()) + ordered.last()->docCount() - docBase > 0x7fffffffu)
+    {
+        *error = "segments to merge span too many document ids";
+        return QByteArray();
+    }
+    QVector<QString> names;
+    SortedTerms terms;
+    foreach(const IndexSegment *segment, ordered)
+    {
+        names.resize( segment->docBase() - docBase );
+        for(quint32 doc=0; doc<segment->docCount(); doc++)
+            names.append( segment->documentName( segment->docBase() + doc ) );
+
+        for(int i=0; i<segment->termCount(); i++)
+        {
+            const SegmentTerm &t = segment->terms[i];
+            if(t.text > segment->header->textSize || t.textLength > segment->header->textSize - t.text)
+                continue;
+            QVector<Posting> &list = terms[QByteArray( segment->text + t.text, t.textLength )];
+            list += segment->postings( i );
+        }
+    }
+
+    return LayOut( language, docBase, names, terms );
+} /* merge */
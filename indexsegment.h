@@ -0,0 +1,142 @@
+/******************************************************************
+
+   One segment of an inverted index of stems: a flat image that is
+   written once, memory mapped and read in place, and merged with
+   other segments into a bigger one.
+
+   The image is a header, a term table sorted by the UTF-8 bytes of
+   the stem for binary search, the stems, the posting lists and the
+   document names.  A posting list is, per document in ascending id
+   order, the id delta from the previous document (from docBase for
+   the first) and the number of times the stem occurs in it, both as
+   varints.
+
+   Licensed under GPLv3. See LICENCE.md file
+
+**/
+
+#ifndef INDEXSEGMENT_H
+#define INDEXSEGMENT_H
+
+#include <QByteArray>
+#include <QString>
+#include <QVector>
+
+#include "imageformat.h"
+#include "steminterner.h"
+#include "textanalyzer.h"
+
+#define INDEX_SEGMENT_MAGIC    0x53495350u  /* "PSIS" read as little endian */
+#define INDEX_SEGMENT_VERSION  1
+
+typedef struct {
+           quint32 magic;          /* INDEX_SEGMENT_MAGIC */
+           quint32 version;        /* INDEX_SEGMENT_VERSION */
+           quint32 size;           /* bytes in the whole image */
+           char language[4];       /* stemmer of the terms, NUL padded */
+           quint32 docBase;        /* id of the first document */
+           quint32 docCount;       /* ids docBase .. docBase + docCount - 1 */
+           quint32 terms;          /* offset of the SegmentTerm array */
+           quint32 termCount;
+           quint32 text;           /* offset of the UTF-8 stems */
+           quint32 textSize;
+           quint32 postings;       /* offset of the posting lists */
+           quint32 postingsSize;
+           quint32 docs;           /* offset of a name offset per document */
+           quint32 names;          /* offset of the NUL terminated names */
+           quint32 namesSize;
+           } SegmentHeader;
+
+typedef struct {
+           quint32 text;           /* offset of the stem in text */
+           quint32 textLength;
+           quint32 docFreq;        /* documents in the posting list */
+           quint32 postings;       /* offset of the list in postings */
+           quint32 postingsSize;
+           } SegmentTerm;
+
+typedef struct {
+           quint32 doc;            /* document id */
+           quint32 frequency;      /* occurrences of the stem in it */
+           } Posting;
+
+/* Collects documents in memory and lays them out as a segment */
+class SegmentWriter
+{
+public:
+    // Stems are counted by their id in stems, which writers building
+    // parts of one index in parallel may share; NULL gives the writer
+    // an interner of its own.
+    SegmentWriter(TextAnalyzer::StemFunction stemFunction, const QString &language, quint32 docBase = 0,
+                  StemInterner *stems = NULL);
+    ~SegmentWriter();
+
+    // Indexes one document and returns its id, docBase for the first
+    // document and one more for each after it.
+    quint32 addDocument(const QString &name, const QString &text);
+
+    int docCount() const { return names.size(); }
+    QByteArray image() const;
+
+private:
+    Q_DISABLE_COPY(SegmentWriter)
+
+    TextAnalyzer analyzer;
+    QString language;
+    quint32 docBase;
+    StemInterner *stems;
+    bool ownStems;                  /* stems was allocated by the writer */
+    QVector<QVector<Posting> > postings;    /* by stem id */
+    QVector<quint32> counts;        /* by stem id, of the current document */
+    QVector<quint32> seen;          /* stem ids counted in the current document */
+    QVector<QString> names;
+};
+
+/* A segment attached to a mapped file or an image in memory */
+class IndexSegment
+{
+public:
+    IndexSegment();
+
+    bool load(const QString &fileName);
+    bool setImage(const QByteArray &image);
+    bool isValid() const { return NULL != header; }
+    QString errorString() const { return error; }
+
+    QString language() const;
+    quint32 docBase() const { return NULL == header ? 0 : header->docBase; }
+    quint32 docCount() const { return NULL == header ? 0 : header->docCount; }
+    QString documentName(quint32 doc) const;
+
+    int termCount() const { return NULL == header ? 0 : int(header->termCount); }
+    QString term(int i) const;
+    QVector<Posting> postings(int i) const;
+
+    // Index of the term for a stem, -1 if no document has it.
+    int findTerm(const QString &stem) const;
+
+    // True if both segments hold a document of the same id.
+    bool overlaps(const IndexSegment &other) const;
+
+    // One segment holding every document of the segments, which must
+    // share a language and have disjoint document ids.
+    static QByteArray merge(const QVector<const IndexSegment *> &segments, QString *error);
+
+private:
+    Q_DISABLE_COPY(IndexSegment)
+
+    bool attach(const uchar *data, qint64 size);
+    bool fail(const QString &message);
+
+    MappedImage mapped;             /* of load() or setImage() */
+    QString error;
+
+    const SegmentHeader *header;    /* NULL until an image is attached */
+    const SegmentTerm *terms;
+    const char *text;
+    const uchar *postingData;
+    const quint32 *docs;
+    const char *names;
+};
+
+#endif // INDEXSEGMENT_H
@@ -0,0 +1,321 @@
+/******************************************************************
+
+   Inverted index of stems over IndexSegment files: builds segments
+   in parallel and answers queries stemmed the way the documents were.
+
+   Licensed under GPLv3. See LICENCE.md file
+
+**/
+
+#include "invertedindex.h"
+#include "enporterstemmer.h"
+#include "lvporterstemmer.h"
+
+#include <QFile>
+#include <QThread>
+#include <QtConcurrent>
+
+#include <algorithm>
+
+/*****************************************************************************/
+/*****************   Private Defines and Data Structures   *******************/
+
+/* Documents of one partial segment built by a pool thread */
+typedef struct {
+           const QStringList *names;   /* whole input list */
+           const QStringList *texts;   /* texts of names, empty to read files */
+           QString language;
+           StemInterner *stems;        /* shared by the chunks of one build */
+           quint32 docBase;            /* id of names[0] */
+           int begin;                  /* first document of this chunk */
+           int end;                    /* one past the last document */
+           QByteArray image;           /* the partial segment */
+           QString error;              /* set if a file could not be read */
+           } IndexChunk;
+
+/*****************************************************************************/
+/********************   Private Function Declarations   **********************/
+static void BuildChunk( IndexChunk &chunk );
+static bool ByDoc( const Posting &a, const Posting &b );
+static QVector<Posting> Intersect( const QVector<Posting> &a, const QVector<Posting> &b );
+
+
+static void BuildChunk( IndexChunk &chunk )
+{
+    SegmentWriter writer( InvertedIndex::stemFunction( chunk.language ), chunk.language, chunk.docBase + chunk.begin,
+                          chunk.stems );
+
+    for(int i=chunk.begin; i<chunk.end; i++)
+    {
+        const QString &name = chunk.names->at(i);
+        if(chunk.texts->isEmpty())
+        {
+            QFile file( name );
+            if(!file.open( QIODevice::ReadOnly ))
+            {
+                chunk.error = name + ": " + file.errorString();
+                return;
+            }
+            writer.addDocument( name, QString::fromUtf8( file.readAll() ) );
+        }
+        else
+            writer.addDocument( name, chunk.texts->at(i) );
+    }
+
+    chunk.image = writer.image();
+} /* BuildChunk */
+
+static bool ByDoc( const Posting &a, const Posting &b )
+{
+    return a.doc < b.doc;
+}
+
+
+/*FN**************************************************************************
+
+       Intersect( a, b )
+
+   Returns: QVector<Posting> -- documents in both lists, with the
+                               frequencies added
+
+   Notes:   Both lists must be in ascending document order.
+**/
+
+static QVector<Posting> Intersect( const QVector<Posting> &a, const QVector<Posting> &b )
+{
+    QVector<Posting> both;
+    int i = 0;
+    int j = 0;
+
+    while(i < a.size() && j < b.size())
+    {
+        if(a.at(i).doc < b.at(j).doc)
+            i++;
+        else if(b.at(j).doc < a.at(i).doc)
+            j++;
+        else
+        {
+            Posting posting = { a.at(i).doc, a.at(i).frequency + b.at(j).frequency };
+            both.append( posting );
+            i++;
+            j++;
+        }
+    }
+
+    return both;
+} /* Intersect */
+
+
+InvertedIndex::InvertedIndex(const QString &language)
+    : language( language )
+{
+}
+
+InvertedIndex::~InvertedIndex()
+{
+    qDeleteAll( segments );
+}
+
+TextAnalyzer::StemFunction InvertedIndex::stemFunction(const QString &language)
+{
+    TextAnalyzer::StemFunction function = NULL;
+
+    if(language == "lv")
+        function = LVPorterStemmer::stem;
+    else if(language == "en")
+        function = ENPorterStemmer::stem;
+
+    return function;
+}
+
+bool InvertedIndex::addSegment(const QString &fileName)
+{
+    IndexSegment *segment = new IndexSegment;
+    return add( segment, segment->load( fileName ) );
+}
+
+bool InvertedIndex::addImage(const QByteArray &image)
+{
+    IndexSegment *segment = new IndexSegment;
+    return add( segment, segment->setImage( image ) );
+}
+
+/*FN**************************************************************************
+
+       add( segment, loaded )
+
+   Returns: bool -- false if the segment did not load, is of another
+                    language or shares document ids with one already
+                    added, in which case it is deleted
+
+   Purpose: search() joins the posting lists of the segments, so their
+            ids must be as disjoint as merge() requires them to be.
+**/
+
+bool InvertedIndex::add(IndexSegment *segment, bool loaded)
+{
+    bool overlap = false;
+    for(int i=0; loaded && i<segments.size(); i++)
+        overlap = overlap || segment->overlaps( *segments.at(i) );
+
+    if(!loaded)
+        error = segment->errorString();
+    else if(segment->language() != language)
+        error = QString( "%1 segment in a %2 index" ).arg( segment->language() ).arg( language );
+    else if(overlap)
+        error = "segments have overlapping document ids";
+    else
+    {
+        segments.append( segment );
+        return true;
+    }
+
+    delete segment;
+    return false;
+}
+
+
+/*FN**************************************************************************
+
+       search( query )
+
+   Returns: QVector<Posting> -- matching documents in ascending id order
+
+   Purpose: Stem the query with the analyzer the documents went through
+            and intersect the posting lists of its distinct stems.  A
+            query of nothing but stop words matches nothing.
+
+   Plan:    The list of a stem is the lists of every segment that has
+            it.  Segments are mapped, so only the lists asked for are
+            read from disk.
+**/
+
+QVector<Posting> InvertedIndex::search(const QString &query) const
+{
+    QVector<Posting> result;
+    TextAnalyzer::StemFunction function = stemFunction( language );
+    if(NULL == function)
+        return result;
+
+    TextAnalyzer analyzer( function );
+    QStringList stems;
+    int n = analyzer.analyze( query );
+    for(int i=0; i<n; i++)
+    {
+        if(analyzer.token(i).stemLength > 0 && !stems.contains( analyzer.stem(i) ))
+            stems.append( analyzer.stem(i) );
+    }
+
+    for(int s=0; s<stems.size(); s++)
+    {
+        QVector<Posting> list;
+        foreach(const IndexSegment *segment, segments)
+        {
+            int term = segment->findTerm( stems.at(s) );
+            if(term >= 0)
+                list += segment->postings( term );
+        }
+        if(segments.size() > 1)
+            std::stable_sort( list.begin(), list.end(), ByDoc );
+
+        result = 0 == s ? list : Intersect( result, list );
+        if(result.isEmpty())
+            break;
+    }
+
+    return result;
+} /* search */
+
+QString InvertedIndex::documentName(quint32 doc) const
+{
+    foreach(const IndexSegment *segment, segments)
+    {
+        if(doc >= segment->docBase() && doc - segment->docBase() < segment->docCount())
+            return segment->documentName( doc );
+    }
+
+    return QString();
+}
+
+
+/*FN**************************************************************************
+
+       build( language, names, texts, docBase, threads, error )
+
+   Returns: QByteArray -- the segment image, empty on failure with the
+                          reason in *error
+
+   Purpose: Index a batch of documents on the global QThreadPool.
+
+   Plan:    Split the documents into one contiguous range per thread,
+            let each build its own segment, then merge the partial
+            segments.  The ranges are in id order, so merging only
+            concatenates posting lists.  The chunks share one
+            StemInterner, so a stem is hashed and stored once however
+            many chunks meet it.  Its ids are global: each writer's
+            postings and counts are indexed by them and grow to the
+            highest id the writer has seen, ids interned by the other
+            chunks included.
+**/
+
+QByteArray InvertedIndex::build(const QString &language, const QStringList &names, const QStringList &texts,
+                                quint32 docBase, int threads, QString *error)
+{
+    if(NULL == stemFunction( language ))
+    {
+        *error = "unknown language " + language;
+        return QByteArray();
+    }
+    if(!texts.isEmpty() && texts.size() != names.size())
+    {
+        *error = "every document needs a name and a text";
+        return QByteArray();
+    }
+
+    if(threads <= 0)
+        threads = QThread::idealThreadCount();
+    threads = qMax( 1, qMin( threads, names.size() ) );
+
+    StemInterner stems;
+    QVector<IndexChunk> chunks( threads );
+    for(int i=0; i<threads; i++)
+    {
+        chunks[i].names = &names;
+        chunks[i].texts = &texts;
+        chunks[i].language = language;
+        chunks[i].stems = &stems;
+        chunks[i].docBase = docBase;
+        chunks[i].begin = int(qint64(names.size()) * i / threads);
+        chunks[i].end = int(qint64(names.size()) * (i + 1) / threads);
+    }
+
+    if(threads > 1)
+        QtConcurrent::blockingMap( chunks, BuildChunk );
+    else
+        BuildChunk( chunks[0] );
+
+    for(int i=0; i<threads; i++)
+    {
+        if(!chunks.at(i).error.isEmpty())
+        {
+            *error = chunks.at(i).error;
+            return QByteArray();
+        }
+    }
+    if(1 == threads)
+        return chunks.at(0).image;
+
+    QVector<IndexSegment *> parts;
+    QVector<const IndexSegment *> loaded;
+    for(int i=0; i<threads; i++)
+    {
+        parts.append( new IndexSegment );
+        parts.last()->setImage( chunks.at(i).image );
+        loaded.append( parts.last() );
+    }
+
+    QByteArray image = IndexSegment::merge( loaded, error );
+    qDeleteAll( parts );
+
+    return image;
+} /* build */
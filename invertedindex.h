@@ -0,0 +1,54 @@
+/******************************************************************
+
+   Inverted index of stems over IndexSegment files: builds segments
+   in parallel and answers queries stemmed the way the documents were.
+
+   Licensed under GPLv3. See LICENCE.md file
+
+**/
+
+#ifndef INVERTEDINDEX_H
+#define INVERTEDINDEX_H
+
+#include <QString>
+#include <QStringList>
+#include <QVector>
+
+#include "indexsegment.h"
+
+class InvertedIndex
+{
+public:
+    // language is "lv" or "en", the stemmer of documents and queries.
+    explicit InvertedIndex(const QString &language);
+    ~InvertedIndex();
+
+    bool addSegment(const QString &fileName);
+    bool addImage(const QByteArray &image);
+    int segmentCount() const { return segments.size(); }
+    QString errorString() const { return error; }
+
+    // Documents holding every stem of the query, in id order, each with
+    // the number of times the query stems occur in it.
+    QVector<Posting> search(const QString &query) const;
+    QString documentName(quint32 doc) const;
+
+    // One segment of the documents, ids from docBase on in list order.
+    // Without texts each name is a UTF-8 file that is read. The
+    // documents are split over threads and the partial segments merged.
+    static QByteArray build(const QString &language, const QStringList &names, const QStringList &texts,
+                            quint32 docBase, int threads, QString *error);
+
+    static TextAnalyzer::StemFunction stemFunction(const QString &language);
+
+private:
+    Q_DISABLE_COPY(InvertedIndex)
+
+    bool add(IndexSegment *segment, bool loaded);
+
+    QString language;
+    QVector<IndexSegment *> segments;
+    QString error;
+};
+
+#endif // INVERTEDINDEX_H
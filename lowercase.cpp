@@ -0,0 +1,157 @@
+/******************************************************************
+
+   Lowering and letter check run on every word before stemming.
+
+   Licensed under GPLv3. See LICENCE.md file
+
+**/
+
+#include "lowercase.h"
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#  include <emmintrin.h>
+#  define LOWERCASE_SSE2
+#endif
+
+/*****************************************************************************/
+/*****************   Private Defines and Data Structures   *******************/
+
+/* Basic Latin, Latin-1 Supplement and Latin Extended-A, which covers all
+   English and Latvian letters */
+#define FAST_RANGE_END 0x180
+
+typedef struct {
+           ushort lower[FAST_RANGE_END];      /* QChar::toLower() */
+           uchar letter[FAST_RANGE_END];      /* QChar::isLetter() */
+           } CaseTable;
+
+
+/*****************************************************************************/
+/********************   Private Function Declarations   **********************/
+static CaseTable BuildCaseTable();
+static const CaseTable &CaseTables();
+
+/*FN**************************************************************************
+
+       BuildCaseTable()
+
+   Returns: CaseTable -- lower case and letter class of the fast range
+
+   Notes:   U+0130 (capital I with dot above) lowers to two characters
+            with the full Unicode mapping QString::toLower() uses, so
+            LowerOne() treats it as outside the fast range.
+**/
+
+static CaseTable BuildCaseTable()
+{
+    CaseTable table;
+
+    for(int i=0; i<FAST_RANGE_END; i++)
+    {
+        QChar c( (ushort)i );
+        table.lower[i] = c.toLower().unicode();
+        table.letter[i] = c.isLetter();
+    }
+
+    return table;
+} /* BuildCaseTable */
+
+/* Built on first use, so a word stemmed from a static initializer of
+   another file never finds the table still zero */
+static const CaseTable &CaseTables()
+{
+    static const CaseTable table = BuildCaseTable();
+    return table;
+}
+
+
+/*FN**************************************************************************
+
+       LowerOne( table, c, flags )
+
+   Purpose: Lower one character in place and clear LOWER_ALPHABETIC from
+            flags if it is not a letter.
+**/
+
+static inline void LowerOne( const CaseTable &table, QChar &c, int &flags )
+{
+    ushort u = c.unicode();
+
+    if ( u < FAST_RANGE_END && 0x130 != u )
+    {
+        c = QChar( table.lower[u] );
+        if ( !table.letter[u] )
+            flags &= ~LOWER_ALPHABETIC;
+    }
+    else
+    {
+        c = c.toLower();
+        if ( !c.isLetter() )
+            flags &= ~LOWER_ALPHABETIC;
+        flags |= LOWER_OUT_OF_RANGE;
+    }
+} /* LowerOne */
+
+
+/*FN**************************************************************************
+
+       LowerWord( word, length )
+
+   Returns: int -- LOWER_ALPHABETIC if every character is a letter, plus
+            LOWER_OUT_OF_RANGE if any character fell outside the fast range
+
+   Purpose: Lower word[0..length) in place and check that it is all
+            letters, the prologue of both stemmers.
+
+   Plan:    With SSE2, eight characters are handled per step while they
+            are all ASCII.  Everything else goes through a table covering
+            up to Latin Extended-A, and only characters beyond that use
+            QChar::toLower() and QChar::isLetter().
+
+   Notes:   Characters outside the fast range get the simple per-character
+            mapping.  Callers that need QString::toLower() semantics should
+            redo the word when LOWER_OUT_OF_RANGE is set.
+**/
+
+int LowerWord(QChar *word, int length)
+{
+    const CaseTable &table = CaseTables();
+    int flags = LOWER_ALPHABETIC;
+    int i = 0;
+
+#ifdef LOWERCASE_SSE2
+    const __m128i non_ascii = _mm_set1_epi16( (short)0xFF80 );
+    const __m128i upper_lo = _mm_set1_epi16( 'A' - 1 );
+    const __m128i upper_hi = _mm_set1_epi16( 'Z' + 1 );
+    const __m128i lower_lo = _mm_set1_epi16( 'a' - 1 );
+    const __m128i lower_hi = _mm_set1_epi16( 'z' + 1 );
+    const __m128i case_bit = _mm_set1_epi16( 0x20 );
+    const __m128i zero = _mm_setzero_si128();
+
+    for(; i + 8 <= length; i += 8)
+    {
+        __m128i *p = reinterpret_cast<__m128i *>( word + i );
+        __m128i v = _mm_loadu_si128( p );
+
+        if ( 0xFFFF != _mm_movemask_epi8( _mm_cmpeq_epi16( _mm_and_si128( v, non_ascii ), zero ) ) )
+        {
+            for(int j=i; j<i+8; j++)
+                LowerOne( table, word[j], flags );
+            continue;
+        }
+
+        __m128i upper = _mm_and_si128( _mm_cmpgt_epi16( v, upper_lo ), _mm_cmplt_epi16( v, upper_hi ) );
+        v = _mm_add_epi16( v, _mm_and_si128( upper, case_bit ) );
+        __m128i letter = _mm_and_si128( _mm_cmpgt_epi16( v, lower_lo ), _mm_cmplt_epi16( v, lower_hi ) );
+        if ( 0xFFFF != _mm_movemask_epi8( letter ) )
+            flags &= ~LOWER_ALPHABETIC;
+
+        _mm_storeu_si128( p, v );
+    }
+#endif
+
+    for(; i<length; i++)
+        LowerOne( table, word[i], flags );
+
+    return flags;
+} /* LowerWord */
@@ -0,0 +1,20 @@
+/******************************************************************
+
+   Lowering and letter check run on every word before stemming.
+
+   Licensed under GPLv3. See LICENCE.md file
+
+**/
+
+#ifndef LOWERCASE_H
+#define LOWERCASE_H
+
+#include <QChar>
+
+/* Flags returned by LowerWord() */
+#define LOWER_ALPHABETIC     1   /* every character is a letter */
+#define LOWER_OUT_OF_RANGE   2   /* some character needed QChar::toLower() */
+
+int LowerWord(QChar *word, int length);
+
+#endif // LOWERCASE_H
@@ -15,1311 +15,1437 @@
 **/
 
 #include "lvporterstemmer.h"
+#include "lowercase.h"
+#include "porterengine.h"
+#include "stembatch.h"
+
+#include <QVarLengthArray>
+
+#include <string.h>
 
 /*****************************************************************************/
 /*****************   Private Defines and Data Structures   *******************/
-#define IsVowel(c)        QString("aāeēiīouū").contains(c)
+#define IsVowel(c)        (0 != (LatClass(c) & LAT_VOWEL))
+
+/* Character classes of the Latvian hot paths, bits of lat_classes.  The
+   WordSize measure is the only one and it needs nothing but vowels */
+#define LAT_VOWEL         1     /* a ā e ē i ī o u ū */
+
+/* Basic Latin, Latin-1 Supplement and Latin Extended-A, which covers all
+   Latvian letters; everything above has no class */
+#define LAT_CLASS_END     0x180
+
+#define LatClass(c)       ((c).unicode() < LAT_CLASS_END ? lat_classes[(c).unicode()] : 0)
+
+/* Latvian for PorterEngine, its rules have no conditions */
+struct LVLanguage
+{
+    static bool isVowel(QChar c);
+    static int condition(int, PorterContext &) { return( false ); }
+    static int runSteps(PorterContext &ctx, int steps);
+#ifdef STEMMER_RULE_STATS
+    static RuleStats *ruleStats();
+#endif
+};
 
+typedef PorterEngine<LVLanguage> LVEngine;
+
+/* Step tables compiled into lookup structures, see Tables() */
 typedef struct {
-           int id;                 /* returned if rule fired */
-           QString old_end;          /* suffix replaced */
-           QString new_end;          /* suffix replacement */
-           int old_offset;         /* from end of word to start of suffix */
-           int new_offset;         /* from beginning to end of new suffix */
-           int min_root_size;      /* min root word size for replacement */
-           int (*condition)(QString &);     /* the replacement test function */
-           } RuleList;
+           WordSet stopWords;      /* the step0 tables merged */
+           SuffixTrie step1a;
+           SuffixTrie step1a1;
+           SuffixTrie step1a2;
+           SuffixTrie step1a3;
+           SuffixTrie step1a4;
+           SuffixTrie step1a5;
+           SuffixTrie step1a6;
+           SuffixTrie step1b1;
+           SuffixTrie step2;
+           SuffixTrie step3;
+           SuffixTrie step4;
+           } LVTables;
 
 //static char LAMBDA[1] = "";        /* the constant empty string */
-static QString LAMBDA = "";
-//static char *end;
-static int endIndex;
+#define LAMBDA  U16("")         /* the constant empty string */
+
+/* LAT_* bits of every character below LAT_CLASS_END, 16 per row */
+#define V  LAT_VOWEL
+static const uchar lat_classes[LAT_CLASS_END] =
+           {
+             /* 0x000 */ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+             /* 0x010 */ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+             /* 0x020 */ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+             /* 0x030 */ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+             /* 0x040 */ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+             /* 0x050 */ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+             /* 0x060 */ 0,V,0,0,0,V,0,0,0,V,0,0,0,0,0,V,
+             /* 0x070 */ 0,0,0,0,0,V,0,0,0,0,0,0,0,0,0,0,
+             /* 0x080 */ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+             /* 0x090 */ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+             /* 0x0A0 */ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+             /* 0x0B0 */ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+             /* 0x0C0 */ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+             /* 0x0D0 */ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+             /* 0x0E0 */ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+             /* 0x0F0 */ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+             /* 0x100 */ 0,V,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+             /* 0x110 */ 0,0,0,V,0,0,0,0,0,0,0,0,0,0,0,0,
+             /* 0x120 */ 0,0,0,0,0,0,0,0,0,0,0,V,0,0,0,0,
+             /* 0x130 */ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+             /* 0x140 */ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+             /* 0x150 */ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+             /* 0x160 */ 0,0,0,0,0,0,0,0,0,0,0,V,0,0,0,0,
+             /* 0x170 */ 0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,0,
+           };
+#undef V
 
 /*****************************************************************************/
 /********************   Private Function Declarations   **********************/
-static int WordSize( QString &word  );
-static int ReplaceEnd( QString & word, RuleList * rule );
-static int CompStopW( QString & word, RuleList * rule );
-static int ReplaceW( QString & word, RuleList * rule );
-
-static int IsLatVowel( QChar ch );
+static const LVTables &Tables();
+static int CompStopW( PorterContext &ctx, const WordSet &stopWords );
+#ifdef STEMMER_RULE_STATS
+static RuleStats *CompileRuleStats();
+static void CountStopWord( PorterContext &ctx, bool stopWord );
+#endif
 
 
 /******************************************************************************/
 /*****************   Initialized Private Data Structures   ********************/
 
-static RuleList step0a_rules[] =
+static const PorterRule step0a_rules[] =
            {
-                {001, "aiz", LAMBDA, 2, -1, -1, NULL},
-                {002, "ap", LAMBDA, 1, -1, -1, NULL},
-                {003, "ar", LAMBDA, 1, -1, -1, NULL},
-                {004, "apakš", LAMBDA, 4, -1, -1, NULL},
-                {005, "ārpus", LAMBDA, 4, -1, -1, NULL},
-                {006, "augšpus", LAMBDA, 6, -1, -1, NULL},
-                {007, "bez", LAMBDA, 2, -1, -1, NULL},
-                {010, "caur", LAMBDA, 3, -1, -1, NULL},
-                {011, "dēļ", LAMBDA, 2, -1, -1, NULL},
-                {012, "gar", LAMBDA, 2, -1, -1, NULL},
-                {013, "iekš", LAMBDA, 3, -1, -1, NULL},
-                {014, "iz", LAMBDA, 1, -1, -1, NULL},
-                {015, "kopš", LAMBDA, 3, -1, -1, NULL},
-                {016, "labad", LAMBDA, 4, -1, -1, NULL},
-                {017, "lejpus", LAMBDA, 5, -1, -1, NULL},
-                {020, "līdz", LAMBDA, 3, -1, -1, NULL},
-                {021, "no", LAMBDA, 1, -1, -1, NULL},
-                {022, "otrpus", LAMBDA, 5, -1, -1, NULL},
-                {023, "pa", LAMBDA, 1, -1, -1, NULL},
-                {024, "par", LAMBDA, 2, -1, -1, NULL},
-                {025, "pār", LAMBDA, 2, -1, -1, NULL},
-                {026, "pēc", LAMBDA, 2, -1, -1, NULL},
-                {027, "pie", LAMBDA, 2, -1, -1, NULL},
-                {030, "pirms", LAMBDA, 4, -1, -1, NULL},
-                {031, "pret", LAMBDA, 3, -1, -1, NULL},
-                {032, "priekš", LAMBDA, 5, -1, -1, NULL},
-                {033, "starp", LAMBDA, 4, -1, -1, NULL},
-                {034, "šaipus", LAMBDA, 5, -1, -1, NULL},
-                {035, "uz", LAMBDA, 1, -1, -1, NULL},
-                {036, "viņpus", LAMBDA, 5, -1, -1, NULL},
-                {037, "virs", LAMBDA, 3, -1, -1, NULL},
-                {040, "virspus", LAMBDA, 6, -1, -1, NULL},
-                {041, "zem", LAMBDA, 2, -1, -1, NULL},
-                {042, "un", LAMBDA, 1, -1, -1, NULL},
-                {043, "bet", LAMBDA, 2, -1, -1, NULL},
-                {044, "jo", LAMBDA, 1, -1, -1, NULL},
-                {045, "ja", LAMBDA, 1, -1, -1, NULL},
-                {046, "ka", LAMBDA, 1, -1, -1, NULL},
-                {047, "lai", LAMBDA, 2, -1, -1, NULL},
-                {050, "tomēr", LAMBDA, 4, -1, -1, NULL},
-                {051, "tikko", LAMBDA, 4, -1, -1, NULL},
-                {052, "turpretī", LAMBDA, 7, -1, -1, NULL},
-                {053, "arī", LAMBDA, 2, -1, -1, NULL},
-                {054, "kaut", LAMBDA, 3, -1, -1, NULL},
-                {055, "gan", LAMBDA, 2, -1, -1, NULL},
-                {056, "tādēļ", LAMBDA, 4, -1, -1, NULL},
-                {057, "tā", LAMBDA, 1, -1, -1, NULL},
-                {060, "ne", LAMBDA, 1, -1, -1, NULL},
-                {061, "tikvien", LAMBDA, 6, -1, -1, NULL},
-                {062, "vien", LAMBDA, 3, -1, -1, NULL},
-                {063, "kā", LAMBDA, 1, -1, -1, NULL},
-                {064, "ir", LAMBDA, 1, -1, -1, NULL},
-                {065, "te", LAMBDA, 1, -1, -1, NULL},
-                {066, "vai", LAMBDA, 2, -1, -1, NULL},
-                {067, "kamēr", LAMBDA, 4, -1, -1, NULL},
-                {070, "apakšpus", LAMBDA, 7, -1, -1, NULL},
-                {071, "ar", LAMBDA, 1, -1, -1, NULL},
-                {072, "diezin", LAMBDA, 5, -1, -1, NULL},
-                {073, "ik", LAMBDA, 1, -1, -1, NULL},
-                {074, "it", LAMBDA, 1, -1, -1, NULL},
-                {075, "taču", LAMBDA, 3, -1, -1, NULL},
-                {076, "nu", LAMBDA, 1, -1, -1, NULL},
-                {077, "pat", LAMBDA, 2, -1, -1, NULL},
-                {000,  NULL,        NULL,    0,  0,  0,  NULL},
+                {001, U16("aiz"), LAMBDA, 2, -1, -1, NO_CONDITION},
+                {002, U16("ap"), LAMBDA, 1, -1, -1, NO_CONDITION},
+                {003, U16("ar"), LAMBDA, 1, -1, -1, NO_CONDITION},
+                {004, U16("apakš"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {005, U16("ārpus"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {006, U16("augšpus"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {007, U16("bez"), LAMBDA, 2, -1, -1, NO_CONDITION},
+                {010, U16("caur"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {011, U16("dēļ"), LAMBDA, 2, -1, -1, NO_CONDITION},
+                {012, U16("gar"), LAMBDA, 2, -1, -1, NO_CONDITION},
+                {013, U16("iekš"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {014, U16("iz"), LAMBDA, 1, -1, -1, NO_CONDITION},
+                {015, U16("kopš"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {016, U16("labad"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {017, U16("lejpus"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {020, U16("līdz"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {021, U16("no"), LAMBDA, 1, -1, -1, NO_CONDITION},
+                {022, U16("otrpus"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {023, U16("pa"), LAMBDA, 1, -1, -1, NO_CONDITION},
+                {024, U16("par"), LAMBDA, 2, -1, -1, NO_CONDITION},
+                {025, U16("pār"), LAMBDA, 2, -1, -1, NO_CONDITION},
+                {026, U16("pēc"), LAMBDA, 2, -1, -1, NO_CONDITION},
+                {027, U16("pie"), LAMBDA, 2, -1, -1, NO_CONDITION},
+                {030, U16("pirms"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {031, U16("pret"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {032, U16("priekš"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {033, U16("starp"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {034, U16("šaipus"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {035, U16("uz"), LAMBDA, 1, -1, -1, NO_CONDITION},
+                {036, U16("viņpus"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {037, U16("virs"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {040, U16("virspus"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {041, U16("zem"), LAMBDA, 2, -1, -1, NO_CONDITION},
+                {042, U16("un"), LAMBDA, 1, -1, -1, NO_CONDITION},
+                {043, U16("bet"), LAMBDA, 2, -1, -1, NO_CONDITION},
+                {044, U16("jo"), LAMBDA, 1, -1, -1, NO_CONDITION},
+                {045, U16("ja"), LAMBDA, 1, -1, -1, NO_CONDITION},
+                {046, U16("ka"), LAMBDA, 1, -1, -1, NO_CONDITION},
+                {047, U16("lai"), LAMBDA, 2, -1, -1, NO_CONDITION},
+                {050, U16("tomēr"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {051, U16("tikko"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {052, U16("turpretī"), LAMBDA, 7, -1, -1, NO_CONDITION},
+                {053, U16("arī"), LAMBDA, 2, -1, -1, NO_CONDITION},
+                {054, U16("kaut"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {055, U16("gan"), LAMBDA, 2, -1, -1, NO_CONDITION},
+                {056, U16("tādēļ"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {057, U16("tā"), LAMBDA, 1, -1, -1, NO_CONDITION},
+                {060, U16("ne"), LAMBDA, 1, -1, -1, NO_CONDITION},
+                {061, U16("tikvien"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {062, U16("vien"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {063, U16("kā"), LAMBDA, 1, -1, -1, NO_CONDITION},
+                {064, U16("ir"), LAMBDA, 1, -1, -1, NO_CONDITION},
+                {065, U16("te"), LAMBDA, 1, -1, -1, NO_CONDITION},
+                {066, U16("vai"), LAMBDA, 2, -1, -1, NO_CONDITION},
+                {067, U16("kamēr"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {070, U16("apakšpus"), LAMBDA, 7, -1, -1, NO_CONDITION},
+                {071, U16("ar"), LAMBDA, 1, -1, -1, NO_CONDITION},
+                {072, U16("diezin"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {073, U16("ik"), LAMBDA, 1, -1, -1, NO_CONDITION},
+                {074, U16("it"), LAMBDA, 1, -1, -1, NO_CONDITION},
+                {075, U16("taču"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {076, U16("nu"), LAMBDA, 1, -1, -1, NO_CONDITION},
+                {077, U16("pat"), LAMBDA, 2, -1, -1, NO_CONDITION},
+                {000,  {NULL, 0},        {NULL, 0},    0,  0,  0,  NO_CONDITION},
            };
 
-static RuleList step0b_rules[] =
+static const PorterRule step0b_rules[] =
            {
-                {001, "tiklab", LAMBDA, 5, -1, -1, NULL},
-                {002, "iekšpus", LAMBDA, 6, -1, -1, NULL},
-                {003, "nedz", LAMBDA, 3, -1, -1, NULL},
-                {004, "tik", LAMBDA, 2, -1, -1, NULL},
-                {005, "nevis", LAMBDA, 4, -1, -1, NULL},
-                {006, "turpretim", LAMBDA, 8, -1, -1, NULL},
-                {007, "jeb", LAMBDA, 2, -1, -1, NULL},
-                {010, "iekam", LAMBDA, 4, -1, -1, NULL},
-                {011, "iekām", LAMBDA, 4, -1, -1, NULL},
-                {012, "iekāms", LAMBDA, 5, -1, -1, NULL},
-                {013, "kolīdz", LAMBDA, 5, -1, -1, NULL},
-                {014, "līdzko", LAMBDA, 5, -1, -1, NULL},
-                {015, "tiklīdz", LAMBDA, 6, -1, -1, NULL},
-                {016, "jebšu", LAMBDA, 4, -1, -1, NULL},
-                {017, "tālab", LAMBDA, 4, -1, -1, NULL},
-                {020, "tāpēc", LAMBDA, 4, -1, -1, NULL},
-                {021, "nekā", LAMBDA, 3, -1, -1, NULL},
-                {022, "itin", LAMBDA, 3, -1, -1, NULL},
-                {023, "jā", LAMBDA, 1, -1, -1, NULL},
-                {024, "jau", LAMBDA, 2, -1, -1, NULL},
-                {025, "jel", LAMBDA, 2, -1, -1, NULL},
-                {026, "nē", LAMBDA, 1, -1, -1, NULL},
-                {027, "nezin", LAMBDA, 4, -1, -1, NULL},
-                {030, "tad", LAMBDA, 2, -1, -1, NULL},
-                {031, "tikai", LAMBDA, 4, -1, -1, NULL},
-                {032, "vis", LAMBDA, 2, -1, -1, NULL},
-                {033, "droši", LAMBDA, 4, -1, -1, NULL},
-                {034, "diemžēl", LAMBDA, 5, -1, -1, NULL},
-                {035, "tak", LAMBDA, 2, -1, -1, NULL},
-                {036, "nebūt", LAMBDA, 4, -1, -1, NULL},
-                {037, "varbūt", LAMBDA, 5, -1, -1, NULL},
-                {040, "klau", LAMBDA, 3, -1, -1, NULL},
-                {041, "lūk", LAMBDA, 2, -1, -1, NULL},
-                {042, "iekams", LAMBDA, 5, -1, -1, NULL},
-                {043, "vien", LAMBDA, 3, -1, -1, NULL},
-                {044, "es", LAMBDA, 1, -1, -1, NULL},
-                {045, "manis", LAMBDA, 4, -1, -1, NULL},
-                {046, "man", LAMBDA, 2, -1, -1, NULL},
-                {047, "mani", LAMBDA, 3, -1, -1, NULL},
-                {050, "manī", LAMBDA, 3, -1, -1, NULL},
-                {051, "mēs", LAMBDA, 2, -1, -1, NULL},
-                {052, "mūsu", LAMBDA, 3, -1, -1, NULL},
-                {053, "mums", LAMBDA, 3, -1, -1, NULL},
-                {054, "mūs", LAMBDA, 2, -1, -1, NULL},
-                {055, "mūsos", LAMBDA, 4, -1, -1, NULL},
-                {056, "tu", LAMBDA, 1, -1, -1, NULL},
-                {057, "tevis", LAMBDA, 4, -1, -1, NULL},
-                {060, "tev", LAMBDA, 2, -1, -1, NULL},
-                {061, "tevi", LAMBDA, 3, -1, -1, NULL},
-                {062, "tevī", LAMBDA, 3, -1, -1, NULL},
-                {063, "jūs", LAMBDA, 2, -1, -1, NULL},
-                {064, "jūsu", LAMBDA, 3, -1, -1, NULL},
-                {065, "jums", LAMBDA, 3, -1, -1, NULL},
-                {066, "jūsos", LAMBDA, 4, -1, -1, NULL},
-                {067, "viņš", LAMBDA, 3, -1, -1, NULL},
-                {070, "viņa", LAMBDA, 3, -1, -1, NULL},
-                {071, "viņam", LAMBDA, 4, -1, -1, NULL},
-                {072, "viņu", LAMBDA, 3, -1, -1, NULL},
-                {073, "viņā", LAMBDA, 3, -1, -1, NULL},
-                {074, "viņi", LAMBDA, 3, -1, -1, NULL},
-                {075, "viņiem", LAMBDA, 5, -1, -1, NULL},
-                {076, "viņus", LAMBDA, 4, -1, -1, NULL},
-                {077, "viņos", LAMBDA, 4, -1, -1, NULL},
-                {000,  NULL,        NULL,    0,  0,  0,  NULL},
+                {001, U16("tiklab"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {002, U16("iekšpus"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {003, U16("nedz"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {004, U16("tik"), LAMBDA, 2, -1, -1, NO_CONDITION},
+                {005, U16("nevis"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {006, U16("turpretim"), LAMBDA, 8, -1, -1, NO_CONDITION},
+                {007, U16("jeb"), LAMBDA, 2, -1, -1, NO_CONDITION},
+                {010, U16("iekam"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {011, U16("iekām"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {012, U16("iekāms"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {013, U16("kolīdz"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {014, U16("līdzko"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {015, U16("tiklīdz"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {016, U16("jebšu"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {017, U16("tālab"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {020, U16("tāpēc"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {021, U16("nekā"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {022, U16("itin"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {023, U16("jā"), LAMBDA, 1, -1, -1, NO_CONDITION},
+                {024, U16("jau"), LAMBDA, 2, -1, -1, NO_CONDITION},
+                {025, U16("jel"), LAMBDA, 2, -1, -1, NO_CONDITION},
+                {026, U16("nē"), LAMBDA, 1, -1, -1, NO_CONDITION},
+                {027, U16("nezin"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {030, U16("tad"), LAMBDA, 2, -1, -1, NO_CONDITION},
+                {031, U16("tikai"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {032, U16("vis"), LAMBDA, 2, -1, -1, NO_CONDITION},
+                {033, U16("droši"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {034, U16("diemžēl"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {035, U16("tak"), LAMBDA, 2, -1, -1, NO_CONDITION},
+                {036, U16("nebūt"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {037, U16("varbūt"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {040, U16("klau"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {041, U16("lūk"), LAMBDA, 2, -1, -1, NO_CONDITION},
+                {042, U16("iekams"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {043, U16("vien"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {044, U16("es"), LAMBDA, 1, -1, -1, NO_CONDITION},
+                {045, U16("manis"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {046, U16("man"), LAMBDA, 2, -1, -1, NO_CONDITION},
+                {047, U16("mani"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {050, U16("manī"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {051, U16("mēs"), LAMBDA, 2, -1, -1, NO_CONDITION},
+                {052, U16("mūsu"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {053, U16("mums"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {054, U16("mūs"), LAMBDA, 2, -1, -1, NO_CONDITION},
+                {055, U16("mūsos"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {056, U16("tu"), LAMBDA, 1, -1, -1, NO_CONDITION},
+                {057, U16("tevis"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {060, U16("tev"), LAMBDA, 2, -1, -1, NO_CONDITION},
+                {061, U16("tevi"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {062, U16("tevī"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {063, U16("jūs"), LAMBDA, 2, -1, -1, NO_CONDITION},
+                {064, U16("jūsu"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {065, U16("jums"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {066, U16("jūsos"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {067, U16("viņš"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {070, U16("viņa"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {071, U16("viņam"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {072, U16("viņu"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {073, U16("viņā"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {074, U16("viņi"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {075, U16("viņiem"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {076, U16("viņus"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {077, U16("viņos"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {000,  {NULL, 0},        {NULL, 0},    0,  0,  0,  NO_CONDITION},
            };
 
-static RuleList step0c_rules[] =
+static const PorterRule step0c_rules[] =
            {
-                {001, "viņas", LAMBDA, 4, -1, -1, NULL},
-                {002, "viņai", LAMBDA, 4, -1, -1, NULL},
-                {003, "viņām", LAMBDA, 4, -1, -1, NULL},
-                {004, "viņās", LAMBDA, 4, -1, -1, NULL},
-                {005, "kurš", LAMBDA, 3, -1, -1, NULL},
-                {006, "kura", LAMBDA, 3, -1, -1, NULL},
-                {007, "kuram", LAMBDA, 4, -1, -1, NULL},
-                {010, "kuru", LAMBDA, 3, -1, -1, NULL},
-                {011, "kurā", LAMBDA, 3, -1, -1, NULL},
-                {012, "kuri", LAMBDA, 3, -1, -1, NULL},
-                {013, "kuriem", LAMBDA, 5, -1, -1, NULL},
-                {014, "kurus", LAMBDA, 4, -1, -1, NULL},
-                {015, "kuros", LAMBDA, 4, -1, -1, NULL},
-                {016, "kuras", LAMBDA, 4, -1, -1, NULL},
-                {017, "kurai", LAMBDA, 4, -1, -1, NULL},
-                {020, "kurām", LAMBDA, 4, -1, -1, NULL},
-                {021, "kurās", LAMBDA, 4, -1, -1, NULL},
-                {022, "viss", LAMBDA, 3, -1, -1, NULL},
-                {023, "visa", LAMBDA, 3, -1, -1, NULL},
-                {024, "visam", LAMBDA, 4, -1, -1, NULL},
-                {025, "visu", LAMBDA, 3, -1, -1, NULL},
-                {026, "visā", LAMBDA, 3, -1, -1, NULL},
-                {027, "visi", LAMBDA, 3, -1, -1, NULL},
-                {030, "visiem", LAMBDA, 5, -1, -1, NULL},
-                {031, "visus", LAMBDA, 4, -1, -1, NULL},
-                {032, "visos", LAMBDA, 4, -1, -1, NULL},
-                {033, "visas", LAMBDA, 4, -1, -1, NULL},
-                {034, "visai", LAMBDA, 4, -1, -1, NULL},
-                {035, "visām", LAMBDA, 4, -1, -1, NULL},
-                {036, "visās", LAMBDA, 4, -1, -1, NULL},
-                {037, "sevis", LAMBDA, 4, -1, -1, NULL},
-                {040, "sev", LAMBDA, 2, -1, -1, NULL},
-                {041, "sevi", LAMBDA, 3, -1, -1, NULL},
-                {042, "sevī", LAMBDA, 3, -1, -1, NULL},
-                {043, "kas", LAMBDA, 2, -1, -1, NULL},
-                {044, "kā", LAMBDA, 1, -1, -1, NULL},
-                {045, "kam", LAMBDA, 2, -1, -1, NULL},
-                {046, "ko", LAMBDA, 1, -1, -1, NULL},
-                {047, "kur", LAMBDA, 2, -1, -1, NULL},
-                {050, "tas", LAMBDA, 2, -1, -1, NULL},
-                {051, "tā", LAMBDA, 1, -1, -1, NULL},
-                {052, "tam", LAMBDA, 2, -1, -1, NULL},
-                {053, "to", LAMBDA, 1, -1, -1, NULL},
-                {054, "tajā", LAMBDA, 3, -1, -1, NULL},
-                {055, "tai", LAMBDA, 2, -1, -1, NULL},
-                {056, "tanī", LAMBDA, 3, -1, -1, NULL},
-                {057, "tās", LAMBDA, 3, -1, -1, NULL},
-                {060, "tie", LAMBDA, 2, -1, -1, NULL},
-                {061, "tiem", LAMBDA, 3, -1, -1, NULL},
-                {062, "tos", LAMBDA, 2, -1, -1, NULL},
-                {063, "tais", LAMBDA, 3, -1, -1, NULL},
-                {064, "tajos", LAMBDA, 4, -1, -1, NULL},
-                {065, "tanīs", LAMBDA, 4, -1, -1, NULL},
-                {066, "tām", LAMBDA, 2, -1, -1, NULL},
-                {067, "tajās", LAMBDA, 4, -1, -1, NULL},
-                {070, "šis", LAMBDA, 2, -1, -1, NULL},
-                {071, "šī", LAMBDA, 1, -1, -1, NULL},
-                {072, "šā", LAMBDA, 1, -1, -1, NULL},
-                {073, "šim", LAMBDA, 2, -1, -1, NULL},
-                {074, "šo", LAMBDA, 1, -1, -1, NULL},
-                {075, "šai", LAMBDA, 2, -1, -1, NULL},
-                {076, "šajā", LAMBDA, 3, -1, -1, NULL},
-                {077, "šinī", LAMBDA, 3, -1, -1, NULL},
-                {000,  NULL,        NULL,    0,  0,  0,  NULL},
+                {001, U16("viņas"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {002, U16("viņai"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {003, U16("viņām"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {004, U16("viņās"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {005, U16("kurš"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {006, U16("kura"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {007, U16("kuram"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {010, U16("kuru"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {011, U16("kurā"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {012, U16("kuri"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {013, U16("kuriem"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {014, U16("kurus"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {015, U16("kuros"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {016, U16("kuras"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {017, U16("kurai"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {020, U16("kurām"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {021, U16("kurās"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {022, U16("viss"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {023, U16("visa"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {024, U16("visam"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {025, U16("visu"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {026, U16("visā"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {027, U16("visi"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {030, U16("visiem"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {031, U16("visus"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {032, U16("visos"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {033, U16("visas"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {034, U16("visai"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {035, U16("visām"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {036, U16("visās"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {037, U16("sevis"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {040, U16("sev"), LAMBDA, 2, -1, -1, NO_CONDITION},
+                {041, U16("sevi"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {042, U16("sevī"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {043, U16("kas"), LAMBDA, 2, -1, -1, NO_CONDITION},
+                {044, U16("kā"), LAMBDA, 1, -1, -1, NO_CONDITION},
+                {045, U16("kam"), LAMBDA, 2, -1, -1, NO_CONDITION},
+                {046, U16("ko"), LAMBDA, 1, -1, -1, NO_CONDITION},
+                {047, U16("kur"), LAMBDA, 2, -1, -1, NO_CONDITION},
+                {050, U16("tas"), LAMBDA, 2, -1, -1, NO_CONDITION},
+                {051, U16("tā"), LAMBDA, 1, -1, -1, NO_CONDITION},
+                {052, U16("tam"), LAMBDA, 2, -1, -1, NO_CONDITION},
+                {053, U16("to"), LAMBDA, 1, -1, -1, NO_CONDITION},
+                {054, U16("tajā"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {055, U16("tai"), LAMBDA, 2, -1, -1, NO_CONDITION},
+                {056, U16("tanī"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {057, U16("tās"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {060, U16("tie"), LAMBDA, 2, -1, -1, NO_CONDITION},
+                {061, U16("tiem"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {062, U16("tos"), LAMBDA, 2, -1, -1, NO_CONDITION},
+                {063, U16("tais"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {064, U16("tajos"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {065, U16("tanīs"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {066, U16("tām"), LAMBDA, 2, -1, -1, NO_CONDITION},
+                {067, U16("tajās"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {070, U16("šis"), LAMBDA, 2, -1, -1, NO_CONDITION},
+                {071, U16("šī"), LAMBDA, 1, -1, -1, NO_CONDITION},
+                {072, U16("šā"), LAMBDA, 1, -1, -1, NO_CONDITION},
+                {073, U16("šim"), LAMBDA, 2, -1, -1, NO_CONDITION},
+                {074, U16("šo"), LAMBDA, 1, -1, -1, NO_CONDITION},
+                {075, U16("šai"), LAMBDA, 2, -1, -1, NO_CONDITION},
+                {076, U16("šajā"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {077, U16("šinī"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {000,  {NULL, 0},        {NULL, 0},    0,  0,  0,  NO_CONDITION},
            };
 
 
-static RuleList step0d_rules[] =
+static const PorterRule step0d_rules[] =
            {
-                {001, "šīs", LAMBDA, 2, -1, -1, NULL},
-                {002, "šās", LAMBDA, 2, -1, -1, NULL},
-                {003, "šie", LAMBDA, 2, -1, -1, NULL},
-                {004, "šiem", LAMBDA, 3, -1, -1, NULL},
-                {005, "šām", LAMBDA, 2, -1, -1, NULL},
-                {006, "šos", LAMBDA, 2, -1, -1, NULL},
-                {007, "šais", LAMBDA, 3, -1, -1, NULL},
-                {010, "šajos", LAMBDA, 4, -1, -1, NULL},
-                {011, "šajās", LAMBDA, 4, -1, -1, NULL},
-                {012, "šinīs", LAMBDA, 4, -1, -1, NULL},
-                {013, "mans", LAMBDA, 3, -1, -1, NULL},
-                {014, "mana", LAMBDA, 3, -1, -1, NULL},
-                {015, "manam", LAMBDA, 4, -1, -1, NULL},
-                {016, "manu", LAMBDA, 3, -1, -1, NULL},
-                {017, "manī", LAMBDA, 3, -1, -1, NULL},
-                {021, "maniem", LAMBDA, 5, -1, -1, NULL},
-                {022, "manus", LAMBDA, 4, -1, -1, NULL},
-                {023, "manos", LAMBDA, 4, -1, -1, NULL},
-                {024, "manas", LAMBDA, 4, -1, -1, NULL},
-                {025, "manai", LAMBDA, 4, -1, -1, NULL},
-                {026, "manām", LAMBDA, 4, -1, -1, NULL},
-                {027, "manās", LAMBDA, 4, -1, -1, NULL},
-                {030, "tavs", LAMBDA, 3, -1, -1, NULL},
-                {031, "tava", LAMBDA, 3, -1, -1, NULL},
-                {032, "tavam", LAMBDA, 4, -1, -1, NULL},
-                {033, "tavu", LAMBDA, 3, -1, -1, NULL},
-                {034, "tavā", LAMBDA, 3, -1, -1, NULL},
-                {035, "tavi", LAMBDA, 3, -1, -1, NULL},
-                {036, "taviem", LAMBDA, 5, -1, -1, NULL},
-                {037, "tavus", LAMBDA, 4, -1, -1, NULL},
-                {040, "tavos", LAMBDA, 4, -1, -1, NULL},
-                {041, "tavas", LAMBDA, 4, -1, -1, NULL},
-                {042, "tavai", LAMBDA, 4, -1, -1, NULL},
-                {043, "tavām", LAMBDA, 4, -1, -1, NULL},
-                {044, "tavās", LAMBDA, 4, -1, -1, NULL},
-                {045, "savs", LAMBDA, 3, -1, -1, NULL},
-                {046, "sava", LAMBDA, 3, -1, -1, NULL},
-                {047, "savam", LAMBDA, 4, -1, -1, NULL},
-                {050, "savu", LAMBDA, 3, -1, -1, NULL},
-                {051, "savā", LAMBDA, 3, -1, -1, NULL},
-                {052, "savi", LAMBDA, 3, -1, -1, NULL},
-                {053, "saviem", LAMBDA, 5, -1, -1, NULL},
-                {054, "savus", LAMBDA, 4, -1, -1, NULL},
-                {055, "savos", LAMBDA, 4, -1, -1, NULL},
-                {056, "savas", LAMBDA, 4, -1, -1, NULL},
-                {057, "savai", LAMBDA, 4, -1, -1, NULL},
-                {060, "savām", LAMBDA, 4, -1, -1, NULL},
-                {061, "savās", LAMBDA, 4, -1, -1, NULL},
-                {062, "cits", LAMBDA, 3, -1, -1, NULL},
-                {063, "cita", LAMBDA, 3, -1, -1, NULL},
-                {064, "citam", LAMBDA, 4, -1, -1, NULL},
-                {065, "citu", LAMBDA, 3, -1, -1, NULL},
-                {066, "citā", LAMBDA, 3, -1, -1, NULL},
-                {067, "citi", LAMBDA, 3, -1, -1, NULL},
-                {070, "citiem", LAMBDA, 5, -1, -1, NULL},
-                {071, "citus", LAMBDA, 4, -1, -1, NULL},
-                {072, "citos", LAMBDA, 4, -1, -1, NULL},
-                {073, "citas", LAMBDA, 4, -1, -1, NULL},
-                {074, "citai", LAMBDA, 4, -1, -1, NULL},
-                {075, "citām", LAMBDA, 4, -1, -1, NULL},
-                {076, "citās", LAMBDA, 4, -1, -1, NULL},
-                {077, "dažs", LAMBDA, 3, -1, -1, NULL},
-                {000,  NULL,        NULL,    0,  0,  0,  NULL},
+                {001, U16("šīs"), LAMBDA, 2, -1, -1, NO_CONDITION},
+                {002, U16("šās"), LAMBDA, 2, -1, -1, NO_CONDITION},
+                {003, U16("šie"), LAMBDA, 2, -1, -1, NO_CONDITION},
+                {004, U16("šiem"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {005, U16("šām"), LAMBDA, 2, -1, -1, NO_CONDITION},
+                {006, U16("šos"), LAMBDA, 2, -1, -1, NO_CONDITION},
+                {007, U16("šais"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {010, U16("šajos"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {011, U16("šajās"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {012, U16("šinīs"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {013, U16("mans"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {014, U16("mana"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {015, U16("manam"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {016, U16("manu"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {017, U16("manī"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {021, U16("maniem"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {022, U16("manus"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {023, U16("manos"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {024, U16("manas"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {025, U16("manai"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {026, U16("manām"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {027, U16("manās"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {030, U16("tavs"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {031, U16("tava"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {032, U16("tavam"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {033, U16("tavu"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {034, U16("tavā"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {035, U16("tavi"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {036, U16("taviem"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {037, U16("tavus"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {040, U16("tavos"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {041, U16("tavas"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {042, U16("tavai"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {043, U16("tavām"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {044, U16("tavās"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {045, U16("savs"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {046, U16("sava"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {047, U16("savam"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {050, U16("savu"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {051, U16("savā"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {052, U16("savi"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {053, U16("saviem"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {054, U16("savus"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {055, U16("savos"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {056, U16("savas"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {057, U16("savai"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {060, U16("savām"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {061, U16("savās"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {062, U16("cits"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {063, U16("cita"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {064, U16("citam"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {065, U16("citu"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {066, U16("citā"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {067, U16("citi"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {070, U16("citiem"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {071, U16("citus"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {072, U16("citos"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {073, U16("citas"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {074, U16("citai"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {075, U16("citām"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {076, U16("citās"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {077, U16("dažs"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {000,  {NULL, 0},        {NULL, 0},    0,  0,  0,  NO_CONDITION},
            };
 
-static RuleList step0e_rules[] =
+static const PorterRule step0e_rules[] =
            {
-                {001, "daža", LAMBDA, 3, -1, -1, NULL},
-                {002, "dažam", LAMBDA, 4, -1, -1, NULL},
-                {003, "dažu", LAMBDA, 3, -1, -1, NULL},
-                {004, "dažā", LAMBDA, 3, -1, -1, NULL},
-                {005, "daži", LAMBDA, 3, -1, -1, NULL},
-                {006, "dažiem", LAMBDA, 5, -1, -1, NULL},
-                {007, "dažus", LAMBDA, 4, -1, -1, NULL},
-                {010, "dažos", LAMBDA, 4, -1, -1, NULL},
-                {011, "dažas", LAMBDA, 4, -1, -1, NULL},
-                {012, "dažai", LAMBDA, 4, -1, -1, NULL},
-                {013, "dažām", LAMBDA, 4, -1, -1, NULL},
-                {014, "dažās", LAMBDA, 4, -1, -1, NULL},
-                {015, "kāds", LAMBDA, 3, -1, -1, NULL},
-                {016, "kāda", LAMBDA, 3, -1, -1, NULL},
-                {017, "kādam", LAMBDA, 4, -1, -1, NULL},
-                {020, "kādu", LAMBDA, 3, -1, -1, NULL},
-                {021, "kādā", LAMBDA, 3, -1, -1, NULL},
-                {022, "kādi", LAMBDA, 3, -1, -1, NULL},
-                {023, "kādiem", LAMBDA, 5, -1, -1, NULL},
-                {024, "kādus", LAMBDA, 4, -1, -1, NULL},
-                {025, "kādos", LAMBDA, 4, -1, -1, NULL},
-                {026, "kādas", LAMBDA, 4, -1, -1, NULL},
-                {027, "kādai", LAMBDA, 4, -1, -1, NULL},
-                {030, "kādām", LAMBDA, 4, -1, -1, NULL},
-                {031, "kādās", LAMBDA, 4, -1, -1, NULL},
-                {032, "kurš", LAMBDA, 3, -1, -1, NULL},
-                {033, "kura", LAMBDA, 3, -1, -1, NULL},
-                {034, "kuram", LAMBDA, 4, -1, -1, NULL},
-                {035, "kuru", LAMBDA, 3, -1, -1, NULL},
-                {036, "kurā", LAMBDA, 3, -1, -1, NULL},
-                {037, "kuri", LAMBDA, 3, -1, -1, NULL},
-                {040, "kuriem", LAMBDA, 5, -1, -1, NULL},
-                {041, "kurus", LAMBDA, 4, -1, -1, NULL},
-                {042, "kuros", LAMBDA, 4, -1, -1, NULL},
-                {043, "kuras", LAMBDA, 4, -1, -1, NULL},
-                {044, "kurai", LAMBDA, 4, -1, -1, NULL},
-                {045, "kurām", LAMBDA, 4, -1, -1, NULL},
-                {046, "kurās", LAMBDA, 4, -1, -1, NULL},
-                {047, "tāds", LAMBDA, 3, -1, -1, NULL},
-                {050, "tāda", LAMBDA, 3, -1, -1, NULL},
-                {051, "tādam", LAMBDA, 4, -1, -1, NULL},
-                {052, "tādu", LAMBDA, 3, -1, -1, NULL},
-                {053, "tādā", LAMBDA, 3, -1, -1, NULL},
-                {054, "tādi", LAMBDA, 3, -1, -1, NULL},
-                {055, "tādiem", LAMBDA, 5, -1, -1, NULL},
-                {056, "tādus", LAMBDA, 4, -1, -1, NULL},
-                {057, "tādos", LAMBDA, 4, -1, -1, NULL},
-                {060, "tādas", LAMBDA, 4, -1, -1, NULL},
-                {061, "tādai", LAMBDA, 4, -1, -1, NULL},
-                {062, "tādām", LAMBDA, 4, -1, -1, NULL},
-                {063, "tādās", LAMBDA, 4, -1, -1, NULL},
-                {064, "šāds", LAMBDA, 3, -1, -1, NULL},
-                {065, "šāda", LAMBDA, 3, -1, -1, NULL},
-                {066, "šādam", LAMBDA, 4, -1, -1, NULL},
-                {067, "šādu", LAMBDA, 3, -1, -1, NULL},
-                {070, "šādā", LAMBDA, 3, -1, -1, NULL},
-                {071, "šādi", LAMBDA, 3, -1, -1, NULL},
-                {072, "šādiem", LAMBDA, 5, -1, -1, NULL},
-                {073, "šādus", LAMBDA, 4, -1, -1, NULL},
-                {074, "šādos", LAMBDA, 4, -1, -1, NULL},
-                {075, "šādas", LAMBDA, 4, -1, -1, NULL},
-                {076, "šādai", LAMBDA, 4, -1, -1, NULL},
-                {077, "šādām", LAMBDA, 4, -1, -1, NULL},
-                {000,  NULL,        NULL,    0,  0,  0,  NULL},
+                {001, U16("daža"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {002, U16("dažam"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {003, U16("dažu"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {004, U16("dažā"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {005, U16("daži"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {006, U16("dažiem"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {007, U16("dažus"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {010, U16("dažos"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {011, U16("dažas"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {012, U16("dažai"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {013, U16("dažām"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {014, U16("dažās"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {015, U16("kāds"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {016, U16("kāda"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {017, U16("kādam"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {020, U16("kādu"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {021, U16("kādā"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {022, U16("kādi"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {023, U16("kādiem"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {024, U16("kādus"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {025, U16("kādos"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {026, U16("kādas"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {027, U16("kādai"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {030, U16("kādām"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {031, U16("kādās"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {032, U16("kurš"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {033, U16("kura"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {034, U16("kuram"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {035, U16("kuru"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {036, U16("kurā"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {037, U16("kuri"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {040, U16("kuriem"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {041, U16("kurus"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {042, U16("kuros"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {043, U16("kuras"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {044, U16("kurai"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {045, U16("kurām"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {046, U16("kurās"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {047, U16("tāds"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {050, U16("tāda"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {051, U16("tādam"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {052, U16("tādu"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {053, U16("tādā"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {054, U16("tādi"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {055, U16("tādiem"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {056, U16("tādus"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {057, U16("tādos"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {060, U16("tādas"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {061, U16("tādai"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {062, U16("tādām"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {063, U16("tādās"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {064, U16("šāds"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {065, U16("šāda"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {066, U16("šādam"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {067, U16("šādu"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {070, U16("šādā"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {071, U16("šādi"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {072, U16("šādiem"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {073, U16("šādus"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {074, U16("šādos"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {075, U16("šādas"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {076, U16("šādai"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {077, U16("šādām"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {000,  {NULL, 0},        {NULL, 0},    0,  0,  0,  NO_CONDITION},
            };
 
-static RuleList step0f_rules[] =
+static const PorterRule step0f_rules[] =
            {
-                {001, "šādās", LAMBDA, 4, -1, -1, NULL},
-                {002, "katrs", LAMBDA, 4, -1, -1, NULL},
-                {003, "katra", LAMBDA, 4, -1, -1, NULL},
-                {004, "katram", LAMBDA, 5, -1, -1, NULL},
-                {005, "katru", LAMBDA, 4, -1, -1, NULL},
-                {006, "katrā", LAMBDA, 4, -1, -1, NULL},
-                {007, "katri", LAMBDA, 4, -1, -1, NULL},
-                {010, "katriem", LAMBDA, 6, -1, -1, NULL},
-                {011, "katrus", LAMBDA, 5, -1, -1, NULL},
-                {012, "katros", LAMBDA, 5, -1, -1, NULL},
-                {013, "katras", LAMBDA, 5, -1, -1, NULL},
-                {014, "katrai", LAMBDA, 5, -1, -1, NULL},
-                {015, "katrām", LAMBDA, 5, -1, -1, NULL},
-                {016, "katrās", LAMBDA, 5, -1, -1, NULL},
-                {017, "manējs", LAMBDA, 5, -1, -1, NULL},
-                {020, "manējā", LAMBDA, 5, -1, -1, NULL},
-                {021, "manējam", LAMBDA, 6, -1, -1, NULL},
-                {022, "manēju", LAMBDA, 5, -1, -1, NULL},
-                {023, "manējā", LAMBDA, 5, -1, -1, NULL},
-                {024, "manēji", LAMBDA, 5, -1, -1, NULL},
-                {025, "manējiem", LAMBDA, 7, -1, -1, NULL},
-                {026, "manējus", LAMBDA, 6, -1, -1, NULL},
-                {027, "manējos", LAMBDA, 6, -1, -1, NULL},
-                {030, "manējais", LAMBDA, 7, -1, -1, NULL},
-                {032, "manējo", LAMBDA, 5, -1, -1, NULL},
-                {033, "manēie", LAMBDA, 6, -1, -1, NULL},
-                {034, "manējās", LAMBDA, 6, -1, -1, NULL},
-                {035, "manējai", LAMBDA, 6, -1, -1, NULL},
-                {036, "manējām", LAMBDA, 6, -1, -1, NULL},
-                {037, "manējas", LAMBDA, 6, -1, -1, NULL},
-                {040, "tavējs", LAMBDA, 5, -1, -1, NULL},
-                {041, "tavēja", LAMBDA, 5, -1, -1, NULL},
-                {042, "tavējam", LAMBDA, 6, -1, -1, NULL},
-                {043, "tavēju", LAMBDA, 5, -1, -1, NULL},
-                {044, "tavējā", LAMBDA, 5, -1, -1, NULL},
-                {045, "tavēji", LAMBDA, 5, -1, -1, NULL},
-                {046, "tavējiem", LAMBDA, 7, -1, -1, NULL},
-                {047, "tavējus", LAMBDA, 6, -1, -1, NULL},
-                {050, "tavējos", LAMBDA, 6, -1, -1, NULL},
-                {051, "tavējais", LAMBDA, 7, -1, -1, NULL},
-                {053, "tavējo", LAMBDA, 5, -1, -1, NULL},
-                {054, "tavējie", LAMBDA, 6, -1, -1, NULL},
-                {055, "tavējās", LAMBDA, 6, -1, -1, NULL},
-                {056, "tavējai", LAMBDA, 6, -1, -1, NULL},
-                {057, "tavējām", LAMBDA, 6, -1, -1, NULL},
-                {060, "tavējas", LAMBDA, 6, -1, -1, NULL},
-                {061, "savējs", LAMBDA, 5, -1, -1, NULL},
-                {062, "savēja", LAMBDA, 5, -1, -1, NULL},
-                {063, "savējam", LAMBDA, 6, -1, -1, NULL},
-                {064, "savēju", LAMBDA, 5, -1, -1, NULL},
-                {065, "savējā", LAMBDA, 5, -1, -1, NULL},
-                {066, "savēji", LAMBDA, 5, -1, -1, NULL},
-                {067, "savējiem", LAMBDA, 7, -1, -1, NULL},
-                {070, "savējus", LAMBDA, 6, -1, -1, NULL},
-                {071, "savējos", LAMBDA, 6, -1, -1, NULL},
-                {072, "savējais", LAMBDA, 7, -1, -1, NULL},
-                {074, "savējo", LAMBDA, 5, -1, -1, NULL},
-                {075, "savējie", LAMBDA, 6, -1, -1, NULL},
-                {076, "savējās", LAMBDA, 6, -1, -1, NULL},
-                {077, "savējai", LAMBDA, 6, -1, -1, NULL},
-                {000,  NULL,        NULL,    0,  0,  0,  NULL},
+                {001, U16("šādās"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {002, U16("katrs"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {003, U16("katra"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {004, U16("katram"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {005, U16("katru"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {006, U16("katrā"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {007, U16("katri"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {010, U16("katriem"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {011, U16("katrus"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {012, U16("katros"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {013, U16("katras"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {014, U16("katrai"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {015, U16("katrām"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {016, U16("katrās"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {017, U16("manējs"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {020, U16("manējā"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {021, U16("manējam"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {022, U16("manēju"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {023, U16("manējā"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {024, U16("manēji"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {025, U16("manējiem"), LAMBDA, 7, -1, -1, NO_CONDITION},
+                {026, U16("manējus"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {027, U16("manējos"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {030, U16("manējais"), LAMBDA, 7, -1, -1, NO_CONDITION},
+                {032, U16("manējo"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {033, U16("manēie"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {034, U16("manējās"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {035, U16("manējai"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {036, U16("manējām"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {037, U16("manējas"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {040, U16("tavējs"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {041, U16("tavēja"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {042, U16("tavējam"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {043, U16("tavēju"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {044, U16("tavējā"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {045, U16("tavēji"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {046, U16("tavējiem"), LAMBDA, 7, -1, -1, NO_CONDITION},
+                {047, U16("tavējus"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {050, U16("tavējos"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {051, U16("tavējais"), LAMBDA, 7, -1, -1, NO_CONDITION},
+                {053, U16("tavējo"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {054, U16("tavējie"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {055, U16("tavējās"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {056, U16("tavējai"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {057, U16("tavējām"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {060, U16("tavējas"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {061, U16("savējs"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {062, U16("savēja"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {063, U16("savējam"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {064, U16("savēju"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {065, U16("savējā"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {066, U16("savēji"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {067, U16("savējiem"), LAMBDA, 7, -1, -1, NO_CONDITION},
+                {070, U16("savējus"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {071, U16("savējos"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {072, U16("savējais"), LAMBDA, 7, -1, -1, NO_CONDITION},
+                {074, U16("savējo"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {075, U16("savējie"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {076, U16("savējās"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {077, U16("savējai"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {000,  {NULL, 0},        {NULL, 0},    0,  0,  0,  NO_CONDITION},
            };
 
-static RuleList step0g_rules[] =
+static const PorterRule step0g_rules[] =
            {
-                {001, "savējām", LAMBDA, 6, -1, -1, NULL},
-                {002, "savējas", LAMBDA, 6, -1, -1, NULL},
-                {003, "viņējs", LAMBDA, 5, -1, -1, NULL},
-                {004, "viņēja", LAMBDA, 5, -1, -1, NULL},
-                {005, "viņējamm", LAMBDA, 6, -1, -1, NULL},
-                {006, "viņēju", LAMBDA, 5, -1, -1, NULL},
-                {007, "viņējā", LAMBDA, 5, -1, -1, NULL},
-                {010, "viņēji", LAMBDA, 5, -1, -1, NULL},
-                {011, "viņējiem", LAMBDA, 7, -1, -1, NULL},
-                {012, "viņējus", LAMBDA, 6, -1, -1, NULL},
-                {013, "viņējos", LAMBDA, 6, -1, -1, NULL},
-                {014, "viņējais", LAMBDA, 7, -1, -1, NULL},
-                {016, "viņējo", LAMBDA, 5, -1, -1, NULL},
-                {017, "viņējie", LAMBDA, 6, -1, -1, NULL},
-                {020, "viņējās", LAMBDA, 6, -1, -1, NULL},
-                {021, "viņējai", LAMBDA, 6, -1, -1, NULL},
-                {022, "viņējām", LAMBDA, 6, -1, -1, NULL},
-                {023, "viņējas", LAMBDA, 6, -1, -1, NULL},
-                {024, "jūsējs", LAMBDA, 5, -1, -1, NULL},
-                {025, "jūsēja", LAMBDA, 5, -1, -1, NULL},
-                {026, "jūsējam", LAMBDA, 6, -1, -1, NULL},
-                {027, "jūsēju", LAMBDA, 5, -1, -1, NULL},
-                {030, "jūsējā", LAMBDA, 5, -1, -1, NULL},
-                {031, "jūsēji", LAMBDA, 5, -1, -1, NULL},
-                {032, "jūsējiem", LAMBDA, 7, -1, -1, NULL},
-                {033, "jūsējus", LAMBDA, 6, -1, -1, NULL},
-                {034, "jūsējos", LAMBDA, 6, -1, -1, NULL},
-                {035, "jūsējais", LAMBDA, 7, -1, -1, NULL},
-                {037, "jūsējo", LAMBDA, 5, -1, -1, NULL},
-                {040, "jūsējie", LAMBDA, 6, -1, -1, NULL},
-                {041, "jūsējās", LAMBDA, 6, -1, -1, NULL},
-                {042, "jūsējai", LAMBDA, 6, -1, -1, NULL},
-                {043, "jūsējām", LAMBDA, 6, -1, -1, NULL},
-                {044, "jūsējas", LAMBDA, 6, -1, -1, NULL},
-                {045, "mūsējs", LAMBDA, 5, -1, -1, NULL},
-                {046, "mūsēja", LAMBDA, 5, -1, -1, NULL},
-                {047, "mūsējam", LAMBDA, 6, -1, -1, NULL},
-                {050, "mūsēju", LAMBDA, 5, -1, -1, NULL},
-                {051, "musējā", LAMBDA, 5, -1, -1, NULL},
-                {052, "mūsēji", LAMBDA, 5, -1, -1, NULL},
-                {053, "mūsējiem", LAMBDA, 7, -1, -1, NULL},
-                {054, "mūsējus", LAMBDA, 6, -1, -1, NULL},
-                {055, "mūsējos", LAMBDA, 6, -1, -1, NULL},
-                {056, "mūsējais", LAMBDA, 7, -1, -1, NULL},
-                {060, "mūsējo", LAMBDA, 5, -1, -1, NULL},
-                {061, "mūsējie", LAMBDA, 6, -1, -1, NULL},
-                {062, "mūsējās", LAMBDA, 6, -1, -1, NULL},
-                {063, "mūsējai", LAMBDA, 6, -1, -1, NULL},
-                {064, "mūsējām", LAMBDA, 6, -1, -1, NULL},
-                {065, "mūsējas", LAMBDA, 6, -1, -1, NULL},
-                {066, "šitas", LAMBDA, 4, -1, -1, NULL},
-                {067, "šitā", LAMBDA, 3, -1, -1, NULL},
-                {070, "šitam", LAMBDA, 4, -1, -1, NULL},
-                {071, "šito", LAMBDA, 3, -1, -1, NULL},
-                {072, "šitai", LAMBDA, 4, -1, -1, NULL},
-                {073, "šitie", LAMBDA, 4, -1, -1, NULL},
-                {074, "šitiem", LAMBDA, 5, -1, -1, NULL},
-                {075, "šitos", LAMBDA, 4, -1, -1, NULL},
-                {076, "šitšs", LAMBDA, 4, -1, -1, NULL},
-                {077, "šitām", LAMBDA, 4, -1, -1, NULL},
-                {000,  NULL,        NULL,    0,  0,  0,  NULL},
+                {001, U16("savējām"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {002, U16("savējas"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {003, U16("viņējs"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {004, U16("viņēja"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {005, U16("viņējamm"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {006, U16("viņēju"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {007, U16("viņējā"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {010, U16("viņēji"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {011, U16("viņējiem"), LAMBDA, 7, -1, -1, NO_CONDITION},
+                {012, U16("viņējus"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {013, U16("viņējos"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {014, U16("viņējais"), LAMBDA, 7, -1, -1, NO_CONDITION},
+                {016, U16("viņējo"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {017, U16("viņējie"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {020, U16("viņējās"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {021, U16("viņējai"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {022, U16("viņējām"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {023, U16("viņējas"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {024, U16("jūsējs"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {025, U16("jūsēja"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {026, U16("jūsējam"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {027, U16("jūsēju"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {030, U16("jūsējā"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {031, U16("jūsēji"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {032, U16("jūsējiem"), LAMBDA, 7, -1, -1, NO_CONDITION},
+                {033, U16("jūsējus"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {034, U16("jūsējos"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {035, U16("jūsējais"), LAMBDA, 7, -1, -1, NO_CONDITION},
+                {037, U16("jūsējo"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {040, U16("jūsējie"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {041, U16("jūsējās"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {042, U16("jūsējai"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {043, U16("jūsējām"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {044, U16("jūsējas"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {045, U16("mūsējs"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {046, U16("mūsēja"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {047, U16("mūsējam"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {050, U16("mūsēju"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {051, U16("musējā"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {052, U16("mūsēji"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {053, U16("mūsējiem"), LAMBDA, 7, -1, -1, NO_CONDITION},
+                {054, U16("mūsējus"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {055, U16("mūsējos"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {056, U16("mūsējais"), LAMBDA, 7, -1, -1, NO_CONDITION},
+                {060, U16("mūsējo"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {061, U16("mūsējie"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {062, U16("mūsējās"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {063, U16("mūsējai"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {064, U16("mūsējām"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {065, U16("mūsējas"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {066, U16("šitas"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {067, U16("šitā"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {070, U16("šitam"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {071, U16("šito"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {072, U16("šitai"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {073, U16("šitie"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {074, U16("šitiem"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {075, U16("šitos"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {076, U16("šitšs"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {077, U16("šitām"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {000,  {NULL, 0},        {NULL, 0},    0,  0,  0,  NO_CONDITION},
            };
 
-static RuleList step0h_rules[] =
+static const PorterRule step0h_rules[] =
            {
-                {001, "šitāds", LAMBDA, 5, -1, -1, NULL},
-                {002, "šitāda", LAMBDA, 5, -1, -1, NULL},
-                {003, "šitādam", LAMBDA, 6, -1, -1, NULL},
-                {004, "šitādu", LAMBDA, 5, -1, -1, NULL},
-                {005, "šitādā", LAMBDA, 5, -1, -1, NULL},
-                {006, "šitādas", LAMBDA, 6, -1, -1, NULL},
-                {007, "šitādai", LAMBDA, 6, -1, -1, NULL},
-                {010, "šitādi", LAMBDA, 5, -1, -1, NULL},
-                {011, "šitādiem", LAMBDA, 7, -1, -1, NULL},
-                {012, "šitādus", LAMBDA, 6, -1, -1, NULL},
-                {013, "šitādos", LAMBDA, 6, -1, -1, NULL},
-                {014, "šitādām", LAMBDA, 6, -1, -1, NULL},
-                {015, "šitādās", LAMBDA, 6, -1, -1, NULL},
-                {016, "ikkatrs", LAMBDA, 6, -1, -1, NULL},
-                {017, "ikkatra", LAMBDA, 6, -1, -1, NULL},
-                {020, "ikkatram", LAMBDA, 7, -1, -1, NULL},
-                {021, "ikkatru", LAMBDA, 6, -1, -1, NULL},
-                {022, "ikkatrā", LAMBDA, 6, -1, -1, NULL},
-                {023, "ikkatras", LAMBDA, 7, -1, -1, NULL},
-                {024, "ikkatrai", LAMBDA, 7, -1, -1, NULL},
-                {025, "ikkatri", LAMBDA, 6, -1, -1, NULL},
-                {026, "ikkatriem", LAMBDA, 8, -1, -1, NULL},
-                {027, "ikkatrus", LAMBDA, 7, -1, -1, NULL},
-                {030, "ikkatros", LAMBDA, 7, -1, -1, NULL},
-                {032, "ikkatrām", LAMBDA, 7, -1, -1, NULL},
-                {033, "ikkatrās", LAMBDA, 7, -1, -1, NULL},
-                {034, "jebkāds", LAMBDA, 6, -1, -1, NULL},
-                {035, "jebkāda", LAMBDA, 6, -1, -1, NULL},
-                {036, "jebkādam", LAMBDA, 7, -1, -1, NULL},
-                {037, "jebkādu", LAMBDA, 6, -1, -1, NULL},
-                {040, "jebkādā", LAMBDA, 6, -1, -1, NULL},
-                {041, "jebkādas", LAMBDA, 7, -1, -1, NULL},
-                {042, "jebkādai", LAMBDA, 7, -1, -1, NULL},
-                {043, "jebkādi", LAMBDA, 6, -1, -1, NULL},
-                {044, "jebkādiem", LAMBDA, 8, -1, -1, NULL},
-                {045, "jebkādus", LAMBDA, 7, -1, -1, NULL},
-                {046, "jebkādos", LAMBDA, 7, -1, -1, NULL},
-                {047, "jebkādām", LAMBDA, 7, -1, -1, NULL},
-                {050, "jebkādās", LAMBDA, 7, -1, -1, NULL},
-                {051, "jebkas", LAMBDA, 5, -1, -1, NULL},
-                {053, "jebkā", LAMBDA, 4, -1, -1, NULL},
-                {054, "jebkam", LAMBDA, 5, -1, -1, NULL},
-                {055, "jebko", LAMBDA, 4, -1, -1, NULL},
-                {056, "jebkurš", LAMBDA, 6, -1, -1, NULL},
-                {057, "jebkura", LAMBDA, 6, -1, -1, NULL},
-                {060, "jebkuram", LAMBDA, 7, -1, -1, NULL},
-                {061, "jebkuru", LAMBDA, 6, -1, -1, NULL},
-                {062, "jebkurā", LAMBDA, 6, -1, -1, NULL},
-                {063, "jebkuras", LAMBDA, 7, -1, -1, NULL},
-                {064, "jebkurai", LAMBDA, 7, -1, -1, NULL},
-                {065, "jebkuri", LAMBDA, 6, -1, -1, NULL},
-                {066, "jebkuriem", LAMBDA, 8, -1, -1, NULL},
-                {067, "jebkurus", LAMBDA, 7, -1, -1, NULL},
-                {070, "jebkuros", LAMBDA, 7, -1, -1, NULL},
-                {071, "jebkurām", LAMBDA, 7, -1, -1, NULL},
-                {072, "jebkurās", LAMBDA, 7, -1, -1, NULL},
-                {074, "ikkurš", LAMBDA, 5, -1, -1, NULL},
-                {075, "ikkura", LAMBDA, 5, -1, -1, NULL},
-                {076, "ikkuram", LAMBDA, 6, -1, -1, NULL},
-                {077, "ikkuru", LAMBDA, 5, -1, -1, NULL},
-                {000,  NULL,        NULL,    0,  0,  0,  NULL},
+                {001, U16("šitāds"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {002, U16("šitāda"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {003, U16("šitādam"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {004, U16("šitādu"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {005, U16("šitādā"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {006, U16("šitādas"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {007, U16("šitādai"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {010, U16("šitādi"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {011, U16("šitādiem"), LAMBDA, 7, -1, -1, NO_CONDITION},
+                {012, U16("šitādus"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {013, U16("šitādos"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {014, U16("šitādām"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {015, U16("šitādās"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {016, U16("ikkatrs"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {017, U16("ikkatra"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {020, U16("ikkatram"), LAMBDA, 7, -1, -1, NO_CONDITION},
+                {021, U16("ikkatru"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {022, U16("ikkatrā"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {023, U16("ikkatras"), LAMBDA, 7, -1, -1, NO_CONDITION},
+                {024, U16("ikkatrai"), LAMBDA, 7, -1, -1, NO_CONDITION},
+                {025, U16("ikkatri"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {026, U16("ikkatriem"), LAMBDA, 8, -1, -1, NO_CONDITION},
+                {027, U16("ikkatrus"), LAMBDA, 7, -1, -1, NO_CONDITION},
+                {030, U16("ikkatros"), LAMBDA, 7, -1, -1, NO_CONDITION},
+                {032, U16("ikkatrām"), LAMBDA, 7, -1, -1, NO_CONDITION},
+                {033, U16("ikkatrās"), LAMBDA, 7, -1, -1, NO_CONDITION},
+                {034, U16("jebkāds"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {035, U16("jebkāda"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {036, U16("jebkādam"), LAMBDA, 7, -1, -1, NO_CONDITION},
+                {037, U16("jebkādu"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {040, U16("jebkādā"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {041, U16("jebkādas"), LAMBDA, 7, -1, -1, NO_CONDITION},
+                {042, U16("jebkādai"), LAMBDA, 7, -1, -1, NO_CONDITION},
+                {043, U16("jebkādi"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {044, U16("jebkādiem"), LAMBDA, 8, -1, -1, NO_CONDITION},
+                {045, U16("jebkādus"), LAMBDA, 7, -1, -1, NO_CONDITION},
+                {046, U16("jebkādos"), LAMBDA, 7, -1, -1, NO_CONDITION},
+                {047, U16("jebkādām"), LAMBDA, 7, -1, -1, NO_CONDITION},
+                {050, U16("jebkādās"), LAMBDA, 7, -1, -1, NO_CONDITION},
+                {051, U16("jebkas"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {053, U16("jebkā"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {054, U16("jebkam"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {055, U16("jebko"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {056, U16("jebkurš"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {057, U16("jebkura"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {060, U16("jebkuram"), LAMBDA, 7, -1, -1, NO_CONDITION},
+                {061, U16("jebkuru"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {062, U16("jebkurā"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {063, U16("jebkuras"), LAMBDA, 7, -1, -1, NO_CONDITION},
+                {064, U16("jebkurai"), LAMBDA, 7, -1, -1, NO_CONDITION},
+                {065, U16("jebkuri"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {066, U16("jebkuriem"), LAMBDA, 8, -1, -1, NO_CONDITION},
+                {067, U16("jebkurus"), LAMBDA, 7, -1, -1, NO_CONDITION},
+                {070, U16("jebkuros"), LAMBDA, 7, -1, -1, NO_CONDITION},
+                {071, U16("jebkurām"), LAMBDA, 7, -1, -1, NO_CONDITION},
+                {072, U16("jebkurās"), LAMBDA, 7, -1, -1, NO_CONDITION},
+                {074, U16("ikkurš"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {075, U16("ikkura"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {076, U16("ikkuram"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {077, U16("ikkuru"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {000,  {NULL, 0},        {NULL, 0},    0,  0,  0,  NO_CONDITION},
            };
 
-static RuleList step0i_rules[] =
+static const PorterRule step0i_rules[] =
            {
-                {001, "ikkurā", LAMBDA, 5, -1, -1, NULL},
-                {002, "ikkuras", LAMBDA, 6, -1, -1, NULL},
-                {003, "ikkurai", LAMBDA, 6, -1, -1, NULL},
-                {004, "ikkuri", LAMBDA, 5, -1, -1, NULL},
-                {005, "ikkuriem", LAMBDA, 7, -1, -1, NULL},
-                {006, "ikkurus", LAMBDA, 6, -1, -1, NULL},
-                {007, "ikkuros", LAMBDA, 6, -1, -1, NULL},
-                {010, "ikkurām", LAMBDA, 6, -1, -1, NULL},
-                {011, "ikkurās", LAMBDA, 6, -1, -1, NULL},
-                {012, "ikviens", LAMBDA, 6, -1, -1, NULL},
-                {013, "ikviena", LAMBDA, 6, -1, -1, NULL},
-                {014, "ikvienam", LAMBDA, 7, -1, -1, NULL},
-                {016, "ikvienu", LAMBDA, 6, -1, -1, NULL},
-                {017, "ikvienā", LAMBDA, 6, -1, -1, NULL},
-                {020, "ikvienas", LAMBDA, 7, -1, -1, NULL},
-                {021, "ikvienai", LAMBDA, 7, -1, -1, NULL},
-                {022, "ikvieni", LAMBDA, 6, -1, -1, NULL},
-                {023, "ikvieniem", LAMBDA, 8, -1, -1, NULL},
-                {024, "ikvienus", LAMBDA, 7, -1, -1, NULL},
-                {025, "ikvienos", LAMBDA, 7, -1, -1, NULL},
-                {026, "ikvienām", LAMBDA, 7, -1, -1, NULL},
-                {027, "ikvienās", LAMBDA, 7, -1, -1, NULL},
-                {030, "nekas", LAMBDA, 4, -1, -1, NULL},
-                {031, "nekā", LAMBDA, 3, -1, -1, NULL},
-                {032, "nekam", LAMBDA, 4, -1, -1, NULL},
-                {033, "neko", LAMBDA, 3, -1, -1, NULL},
-                {034, "nekāds", LAMBDA, 5, -1, -1, NULL},
-                {035, "nekāda", LAMBDA, 5, -1, -1, NULL},
-                {037, "nekādam", LAMBDA, 6, -1, -1, NULL},
-                {040, "nekādu", LAMBDA, 5, -1, -1, NULL},
-                {041, "nekādā", LAMBDA, 5, -1, -1, NULL},
-                {042, "nekādas", LAMBDA, 6, -1, -1, NULL},
-                {043, "nekādai", LAMBDA, 6, -1, -1, NULL},
-                {044, "nekādi", LAMBDA, 5, -1, -1, NULL},
-                {045, "nekādiem", LAMBDA, 7, -1, -1, NULL},
-                {046, "nekādus", LAMBDA, 6, -1, -1, NULL},
-                {047, "nekādos", LAMBDA, 6, -1, -1, NULL},
-                {050, "nekādām", LAMBDA, 6, -1, -1, NULL},
-                {051, "nekādās", LAMBDA, 6, -1, -1, NULL},
-                {052, "neviens", LAMBDA, 6, -1, -1, NULL},
-                {053, "neviena", LAMBDA, 6, -1, -1, NULL},
-                {054, "nevienam", LAMBDA, 7, -1, -1, NULL},
-                {055, "nevienu", LAMBDA, 6, -1, -1, NULL},
-                {056, "nevienā", LAMBDA, 6, -1, -1, NULL},
-                {060, "nevienās", LAMBDA, 6, -1, -1, NULL},
-                {061, "nevienai", LAMBDA, 7, -1, -1, NULL},
-                {062, "nevieni", LAMBDA, 6, -1, -1, NULL},
-                {063, "nevieniem",LAMBDA, 8, -1, -1, NULL},
-                {064, "nevienus", LAMBDA, 7, -1, -1, NULL},
-                {065, "nevienos", LAMBDA, 7, -1, -1, NULL},
-                {066, "nevienām", LAMBDA, 7, -1, -1, NULL},
-                {067, "nevienās", LAMBDA, 7, -1, -1, NULL},
-                {070, "pats", LAMBDA, 3, -1, -1, NULL},
-                {071, "paša", LAMBDA, 3, -1, -1, NULL},
-                {072, "pašam", LAMBDA, 4, -1, -1, NULL},
-                {073, "pagu", LAMBDA, 3, -1, -1, NULL},
-                {074, "pašu", LAMBDA, 3, -1, -1, NULL},
-                {075, "pati", LAMBDA, 3, -1, -1, NULL},
-                {076, "pašas", LAMBDA, 4, -1, -1, NULL},
-                {077, "pašai", LAMBDA, 4, -1, -1, NULL},
-                {000,  NULL,        NULL,    0,  0,  0,  NULL},
+                {001, U16("ikkurā"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {002, U16("ikkuras"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {003, U16("ikkurai"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {004, U16("ikkuri"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {005, U16("ikkuriem"), LAMBDA, 7, -1, -1, NO_CONDITION},
+                {006, U16("ikkurus"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {007, U16("ikkuros"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {010, U16("ikkurām"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {011, U16("ikkurās"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {012, U16("ikviens"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {013, U16("ikviena"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {014, U16("ikvienam"), LAMBDA, 7, -1, -1, NO_CONDITION},
+                {016, U16("ikvienu"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {017, U16("ikvienā"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {020, U16("ikvienas"), LAMBDA, 7, -1, -1, NO_CONDITION},
+                {021, U16("ikvienai"), LAMBDA, 7, -1, -1, NO_CONDITION},
+                {022, U16("ikvieni"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {023, U16("ikvieniem"), LAMBDA, 8, -1, -1, NO_CONDITION},
+                {024, U16("ikvienus"), LAMBDA, 7, -1, -1, NO_CONDITION},
+                {025, U16("ikvienos"), LAMBDA, 7, -1, -1, NO_CONDITION},
+                {026, U16("ikvienām"), LAMBDA, 7, -1, -1, NO_CONDITION},
+                {027, U16("ikvienās"), LAMBDA, 7, -1, -1, NO_CONDITION},
+                {030, U16("nekas"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {031, U16("nekā"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {032, U16("nekam"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {033, U16("neko"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {034, U16("nekāds"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {035, U16("nekāda"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {037, U16("nekādam"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {040, U16("nekādu"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {041, U16("nekādā"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {042, U16("nekādas"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {043, U16("nekādai"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {044, U16("nekādi"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {045, U16("nekādiem"), LAMBDA, 7, -1, -1, NO_CONDITION},
+                {046, U16("nekādus"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {047, U16("nekādos"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {050, U16("nekādām"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {051, U16("nekādās"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {052, U16("neviens"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {053, U16("neviena"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {054, U16("nevienam"), LAMBDA, 7, -1, -1, NO_CONDITION},
+                {055, U16("nevienu"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {056, U16("nevienā"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {060, U16("nevienās"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {061, U16("nevienai"), LAMBDA, 7, -1, -1, NO_CONDITION},
+                {062, U16("nevieni"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {063, U16("nevieniem"),LAMBDA, 8, -1, -1, NO_CONDITION},
+                {064, U16("nevienus"), LAMBDA, 7, -1, -1, NO_CONDITION},
+                {065, U16("nevienos"), LAMBDA, 7, -1, -1, NO_CONDITION},
+                {066, U16("nevienām"), LAMBDA, 7, -1, -1, NO_CONDITION},
+                {067, U16("nevienās"), LAMBDA, 7, -1, -1, NO_CONDITION},
+                {070, U16("pats"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {071, U16("paša"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {072, U16("pašam"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {073, U16("pagu"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {074, U16("pašu"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {075, U16("pati"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {076, U16("pašas"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {077, U16("pašai"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {000,  {NULL, 0},        {NULL, 0},    0,  0,  0,  NO_CONDITION},
            };
 
-static RuleList step0j_rules[] =
+static const PorterRule step0j_rules[] =
            {
-                {001, "paši", LAMBDA, 3, -1, -1, NULL},
-                {002, "pašiem", LAMBDA, 5, -1, -1, NULL},
-                {003, "pašus", LAMBDA, 4, -1, -1, NULL},
-                {004, "pašos", LAMBDA, 4, -1, -1, NULL},
-                {005, "pašām", LAMBDA, 4, -1, -1, NULL},
-                {006, "pašās", LAMBDA, 4, -1, -1, NULL},
-                {007, "būt", LAMBDA, 2, -1, -1, NULL},
-                {010, "biju", LAMBDA, 3, -1, -1, NULL},
-                {011, "biji", LAMBDA, 3, -1, -1, NULL},
-                {012, "bija", LAMBDA, 3, -1, -1, NULL},
-                {013, "bijām", LAMBDA, 4, -1, -1, NULL},
-                {014, "bijāt", LAMBDA, 4, -1, -1, NULL},
-                {015, "esmu", LAMBDA, 3, -1, -1, NULL},
-                {016, "esi", LAMBDA, 2, -1, -1, NULL},
-                {017, "esam", LAMBDA, 3, -1, -1, NULL},
-                {020, "esat", LAMBDA, 3, -1, -1, NULL},
-                {021, "būšu", LAMBDA, 3, -1, -1, NULL},
-                {022, "būsi", LAMBDA, 3, -1, -1, NULL},
-                {023, "būs", LAMBDA, 2, -1, -1, NULL},
-                {024, "būsim", LAMBDA, 4, -1, -1, NULL},
-                {025, "būsiet", LAMBDA, 5, -1, -1, NULL},
-                {026, "tikt", LAMBDA, 3, -1, -1, NULL},
-                {027, "tiku", LAMBDA, 3, -1, -1, NULL},
-                {030, "tiki", LAMBDA, 3, -1, -1, NULL},
-                {031, "tika", LAMBDA, 3, -1, -1, NULL},
-                {032, "tikām", LAMBDA, 4, -1, -1, NULL},
-                {033, "tikāt", LAMBDA, 4, -1, -1, NULL},
-                {034, "tieku", LAMBDA, 4, -1, -1, NULL},
-                {035, "tiec", LAMBDA, 3, -1, -1, NULL},
-                {037, "tiek", LAMBDA, 3, -1, -1, NULL},
-                {040, "tiekam", LAMBDA, 5, -1, -1, NULL},
-                {041, "tiekat", LAMBDA, 5, -1, -1, NULL},
-                {042, "tikšu", LAMBDA, 4, -1, -1, NULL},
-                {043, "tiks", LAMBDA, 3, -1, -1, NULL},
-                {044, "tiksim", LAMBDA, 5, -1, -1, NULL},
-                {045, "tiksiet", LAMBDA, 6, -1, -1, NULL},
-                {046, "tapt", LAMBDA, 3, -1, -1, NULL},
-                {047, "tapi", LAMBDA, 3, -1, -1, NULL},
-                {050, "tapāt", LAMBDA, 4, -1, -1, NULL},
-                {051, "topat", LAMBDA, 4, -1, -1, NULL},
-                {052, "tapšu", LAMBDA, 4, -1, -1, NULL},
-                {053, "tapsi", LAMBDA, 4, -1, -1, NULL},
-                {054, "taps", LAMBDA, 3, -1, -1, NULL},
-                {055, "tapsim", LAMBDA, 5, -1, -1, NULL},
-                {056, "tapsiet", LAMBDA, 6, -1, -1, NULL},
-                {057, "kļūt", LAMBDA, 3, -1, -1, NULL},
-                {060, "kļuvu", LAMBDA, 4, -1, -1, NULL},
-                {061, "kļuvi", LAMBDA, 4, -1, -1, NULL},
-                {062, "kļuva", LAMBDA, 4, -1, -1, NULL},
-                {063, "kļuvām", LAMBDA, 5, -1, -1, NULL},
-                {064, "kļuvāt", LAMBDA, 5, -1, -1, NULL},
-                {065, "kļūstu", LAMBDA, 5, -1, -1, NULL},
-                {066, "kļūsti", LAMBDA, 5, -1, -1, NULL},
-                {067, "kļūst", LAMBDA, 4, -1, -1, NULL},
-                {070, "kļūstam", LAMBDA, 6, -1, -1, NULL},
-                {071, "kļūstat", LAMBDA, 6, -1, -1, NULL},
-                {072, "kļūšu", LAMBDA, 4, -1, -1, NULL},
-                {073, "kļūsi", LAMBDA, 4, -1, -1, NULL},
-                {074, "kļūs", LAMBDA, 3, -1, -1, NULL},
-                {075, "kļūsim", LAMBDA, 5, -1, -1, NULL},
-                {076, "kļūsiet", LAMBDA, 6, -1, -1, NULL},
-                {000,  NULL,        NULL,    0,  0,  0,  NULL},
+                {001, U16("paši"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {002, U16("pašiem"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {003, U16("pašus"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {004, U16("pašos"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {005, U16("pašām"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {006, U16("pašās"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {007, U16("būt"), LAMBDA, 2, -1, -1, NO_CONDITION},
+                {010, U16("biju"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {011, U16("biji"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {012, U16("bija"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {013, U16("bijām"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {014, U16("bijāt"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {015, U16("esmu"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {016, U16("esi"), LAMBDA, 2, -1, -1, NO_CONDITION},
+                {017, U16("esam"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {020, U16("esat"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {021, U16("būšu"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {022, U16("būsi"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {023, U16("būs"), LAMBDA, 2, -1, -1, NO_CONDITION},
+                {024, U16("būsim"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {025, U16("būsiet"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {026, U16("tikt"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {027, U16("tiku"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {030, U16("tiki"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {031, U16("tika"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {032, U16("tikām"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {033, U16("tikāt"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {034, U16("tieku"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {035, U16("tiec"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {037, U16("tiek"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {040, U16("tiekam"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {041, U16("tiekat"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {042, U16("tikšu"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {043, U16("tiks"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {044, U16("tiksim"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {045, U16("tiksiet"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {046, U16("tapt"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {047, U16("tapi"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {050, U16("tapāt"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {051, U16("topat"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {052, U16("tapšu"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {053, U16("tapsi"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {054, U16("taps"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {055, U16("tapsim"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {056, U16("tapsiet"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {057, U16("kļūt"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {060, U16("kļuvu"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {061, U16("kļuvi"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {062, U16("kļuva"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {063, U16("kļuvām"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {064, U16("kļuvāt"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {065, U16("kļūstu"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {066, U16("kļūsti"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {067, U16("kļūst"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {070, U16("kļūstam"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {071, U16("kļūstat"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {072, U16("kļūšu"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {073, U16("kļūsi"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {074, U16("kļūs"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {075, U16("kļūsim"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {076, U16("kļūsiet"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {000,  {NULL, 0},        {NULL, 0},    0,  0,  0,  NO_CONDITION},
            };
 
-static RuleList step0k_rules[] =
+static const PorterRule step0k_rules[] =
            {
-                {001, "ūja", LAMBDA, 2, -1, -1, NULL},
-                {002, "urrā", LAMBDA, 3, -1, -1, NULL},
-                {003, "urā", LAMBDA, 2, -1, -1, NULL},
-                {004, "re", LAMBDA, 1, -1, -1, NULL},
-                {005, "pag", LAMBDA, 2, -1, -1, NULL},
-                {006, "raug", LAMBDA, 3, -1, -1, NULL},
-                {007, "paraug", LAMBDA, 5, -1, -1, NULL},
-                {010, "ai", LAMBDA, 1, -1, -1, NULL},
-                {011, "ak", LAMBDA, 1, -1, -1, NULL},
-                {012, "palūk", LAMBDA, 4, -1, -1, NULL},
-                {013, "nudien", LAMBDA, 5, -1, -1, NULL},
-                {014, "ekur", LAMBDA, 3, -1, -1, NULL},
-                {015, "kuš", LAMBDA, 2, -1, -1, NULL},
-                {016, "skat", LAMBDA, 3, -1, -1, NULL},
-                {017, "paskat", LAMBDA, 5, -1, -1, NULL},
-                {020, "paklau", LAMBDA, 5, -1, -1, NULL},
-                {021, "ņau", LAMBDA, 2, -1, -1, NULL},
-                {022, "rau", LAMBDA, 2, -1, -1, NULL},
-                {023, "parau", LAMBDA, 4, -1, -1, NULL},
-                {024, "nu", LAMBDA, 1, -1, -1, NULL},
-                {025, "tpū", LAMBDA, 2, -1, -1, NULL},
-                {026, "vau", LAMBDA, 1, -1, -1, NULL},
-                {027, "redz", LAMBDA, 3, -1, -1, NULL},
-                {030, "varēt", LAMBDA, 4, -1, -1, NULL},
-                {031, "var", LAMBDA, 2, -1, -1, NULL},
-                {032, "varat", LAMBDA, 4, -1, -1, NULL},
-                {033, "varēju", LAMBDA, 5, -1, -1, NULL},
-                {034, "varēji", LAMBDA, 5, -1, -1, NULL},
-                {035, "varēja", LAMBDA, 5, -1, -1, NULL},
-                {036, "varējām", LAMBDA, 6, -1, -1, NULL},
-                {037, "varējāt", LAMBDA, 6, -1, -1, NULL},
-                {040, "varēšu", LAMBDA, 5, -1, -1, NULL},
-                {041, "varēsi", LAMBDA, 5, -1, -1, NULL},
-                {042, "varēs", LAMBDA, 4, -1, -1, NULL},
-                {043, "varēsim", LAMBDA, 6, -1, -1, NULL},
-                {044, "varēsiet", LAMBDA, 7, -1, -1, NULL},
-                {045, "kāpēc", LAMBDA, 4, -1, -1, NULL},
-                {046, "kādēļ", LAMBDA, 4, -1, -1, NULL},
-                {047, "kālab", LAMBDA, 4, -1, -1, NULL},
-                {050, "tālab", LAMBDA, 4, -1, -1, NULL},
-                {051, "kālabad", LAMBDA, 6, -1, -1, NULL},
-                {052, "tālabad", LAMBDA, 6, -1, -1, NULL},
-                {053, "kamdēļ", LAMBDA, 5, -1, -1, NULL},
-                {054, "tamdēļ", LAMBDA, 5, -1, -1, NULL},
-                {055, "bezgala", LAMBDA, 6, -1, -1, NULL},
-                {056, "nenieka", LAMBDA, 6, -1, -1, NULL},
-                {057, "samērā", LAMBDA, 5, -1, -1, NULL},
-                {060, "vērā", LAMBDA, 3, -1, -1, NULL},
-                {061, "visupēc", LAMBDA, 6, -1, -1, NULL},
-                {062, "tagad", LAMBDA, 4, -1, -1, NULL},
-                {063, "kad", LAMBDA, 2, -1, -1, NULL},
-                {064, "jebkad", LAMBDA, 5, -1, -1, NULL},
-                {065, "nekad", LAMBDA, 4, -1, -1, NULL},
-                {066, "šad", LAMBDA, 2, -1, -1, NULL},
-                {067, "še", LAMBDA, 1, -1, -1, NULL},
-                {070, "tādējādi", LAMBDA, 7, -1, -1, NULL},
-                {071, "visādi", LAMBDA, 5, -1, -1, NULL},
-                {072, "visvisādi", LAMBDA, 8, -1, -1, NULL},
-                {073, "citādi", LAMBDA, 5, -1, -1, NULL},
-                {074, "parasti", LAMBDA, 6, -1, -1, NULL},
-                {075, "dikti", LAMBDA, 4, -1, -1, NULL},
-                {076, "ļoti", LAMBDA, 3, -1, -1, NULL},
-                {077, "velti", LAMBDA, 4, -1, -1, NULL},
-                {000,  NULL,        NULL,    0,  0,  0,  NULL},
+                {001, U16("ūja"), LAMBDA, 2, -1, -1, NO_CONDITION},
+                {002, U16("urrā"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {003, U16("urā"), LAMBDA, 2, -1, -1, NO_CONDITION},
+                {004, U16("re"), LAMBDA, 1, -1, -1, NO_CONDITION},
+                {005, U16("pag"), LAMBDA, 2, -1, -1, NO_CONDITION},
+                {006, U16("raug"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {007, U16("paraug"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {010, U16("ai"), LAMBDA, 1, -1, -1, NO_CONDITION},
+                {011, U16("ak"), LAMBDA, 1, -1, -1, NO_CONDITION},
+                {012, U16("palūk"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {013, U16("nudien"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {014, U16("ekur"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {015, U16("kuš"), LAMBDA, 2, -1, -1, NO_CONDITION},
+                {016, U16("skat"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {017, U16("paskat"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {020, U16("paklau"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {021, U16("ņau"), LAMBDA, 2, -1, -1, NO_CONDITION},
+                {022, U16("rau"), LAMBDA, 2, -1, -1, NO_CONDITION},
+                {023, U16("parau"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {024, U16("nu"), LAMBDA, 1, -1, -1, NO_CONDITION},
+                {025, U16("tpū"), LAMBDA, 2, -1, -1, NO_CONDITION},
+                {026, U16("vau"), LAMBDA, 1, -1, -1, NO_CONDITION},
+                {027, U16("redz"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {030, U16("varēt"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {031, U16("var"), LAMBDA, 2, -1, -1, NO_CONDITION},
+                {032, U16("varat"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {033, U16("varēju"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {034, U16("varēji"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {035, U16("varēja"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {036, U16("varējām"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {037, U16("varējāt"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {040, U16("varēšu"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {041, U16("varēsi"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {042, U16("varēs"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {043, U16("varēsim"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {044, U16("varēsiet"), LAMBDA, 7, -1, -1, NO_CONDITION},
+                {045, U16("kāpēc"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {046, U16("kādēļ"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {047, U16("kālab"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {050, U16("tālab"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {051, U16("kālabad"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {052, U16("tālabad"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {053, U16("kamdēļ"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {054, U16("tamdēļ"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {055, U16("bezgala"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {056, U16("nenieka"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {057, U16("samērā"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {060, U16("vērā"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {061, U16("visupēc"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {062, U16("tagad"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {063, U16("kad"), LAMBDA, 2, -1, -1, NO_CONDITION},
+                {064, U16("jebkad"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {065, U16("nekad"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {066, U16("šad"), LAMBDA, 2, -1, -1, NO_CONDITION},
+                {067, U16("še"), LAMBDA, 1, -1, -1, NO_CONDITION},
+                {070, U16("tādējādi"), LAMBDA, 7, -1, -1, NO_CONDITION},
+                {071, U16("visādi"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {072, U16("visvisādi"), LAMBDA, 8, -1, -1, NO_CONDITION},
+                {073, U16("citādi"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {074, U16("parasti"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {075, U16("dikti"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {076, U16("ļoti"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {077, U16("velti"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {000,  {NULL, 0},        {NULL, 0},    0,  0,  0,  NO_CONDITION},
            };
 
-static RuleList step0l_rules[] =
+static const PorterRule step0l_rules[] =
            {
-                {001, "pēkšņi", LAMBDA, 5, -1, -1, NULL},
-                {002, "respektīvi", LAMBDA, 9, -1, -1, NULL},
-                {003, "līdzi", LAMBDA, 4, -1, -1, NULL},
-                {004, "pretī", LAMBDA, 4, -1, -1, NULL},
-                {005, "labāk", LAMBDA, 4, -1, -1, NULL},
-                {006, "pēcāk", LAMBDA, 4, -1, -1, NULL},
-                {007, "citādāk", LAMBDA, 6, -1, -1, NULL},
-                {010, "savādāk", LAMBDA, 6, -1, -1, NULL},
-                {011, "turpmāk", LAMBDA, 6, -1, -1, NULL},
-                {012, "pārāk", LAMBDA, 4, -1, -1, NULL},
-                {013, "agrāk", LAMBDA, 4, -1, -1, NULL},
-                {014, "vairāk", LAMBDA, 5, -1, -1, NULL},
-                {015, "visvairāk", LAMBDA, 8, -1, -1, NULL},
-                {016, "mazāk", LAMBDA, 4, -1, -1, NULL},
-                {017, "drīzāk", LAMBDA, 5, -1, -1, NULL},
-                {020, "visbiežāk", LAMBDA, 8, -1, -1, NULL},
-                {021, "cik", LAMBDA, 2, -1, -1, NULL},
-                {022, "necik", LAMBDA, 4, -1, -1, NULL},
-                {023, "šitik", LAMBDA, 4, -1, -1, NULL},
-                {024, "atkal", LAMBDA, 4, -1, -1, NULL},
-                {025, "tūdaļ", LAMBDA, 4, -1, -1, NULL},
-                {026, "pakaļ", LAMBDA, 4, -1, -1, NULL},
-                {027, "iepakaļ", LAMBDA, 6, -1, -1, NULL},
-                {030, "nopakaļ", LAMBDA, 6, -1, -1, NULL},
-                {031, "visnotaļ", LAMBDA, 7, -1, -1, NULL},
-                {032, "atpakaļ", LAMBDA, 6, -1, -1, NULL},
-                {033, "palaikam", LAMBDA, 7, -1, -1, NULL},
-                {034, "aplam", LAMBDA, 4, -1, -1, NULL},
-                {035, "piemēram", LAMBDA, 7, -1, -1, NULL},
-                {036, "apmēram", LAMBDA, 6, -1, -1, NULL},
-                {037, "nepagalam", LAMBDA, 8, -1, -1, NULL},
-                {040, "pavisam", LAMBDA, 6, -1, -1, NULL},
-                {041, "nepavisam", LAMBDA, 8, -1, -1, NULL},
-                {042, "paretam", LAMBDA, 6, -1, -1, NULL},
-                {043, "šimbrīžam", LAMBDA, 8, -1, -1, NULL},
-                {044, "joprojām", LAMBDA, 7, -1, -1, NULL},
-                {045, "aumaļām", LAMBDA, 6, -1, -1, NULL},
-                {046, "lēnām", LAMBDA, 4, -1, -1, NULL},
-                {047, "pamazām", LAMBDA, 6, -1, -1, NULL},
-                {050, "gaužām", LAMBDA, 5, -1, -1, NULL},
-                {051, "aizgūtnēm", LAMBDA, 8, -1, -1, NULL},
-                {052, "pārpārēm", LAMBDA, 7, -1, -1, NULL},
-                {053, "caurcaurēm", LAMBDA, 9, -1, -1, NULL},
-                {054, "pamazītēm", LAMBDA, 8, -1, -1, NULL},
-                {055, "pretim", LAMBDA, 5, -1, -1, NULL},
-                {056, "iepretim", LAMBDA, 7, -1, -1, NULL},
-                {057, "prom", LAMBDA, 3, -1, -1, NULL},
-                {060, "patlaban", LAMBDA, 7, -1, -1, NULL},
-                {061, "diezgan", LAMBDA, 6, -1, -1, NULL},
-                {062, "šeitan", LAMBDA, 5, -1, -1, NULL},
-                {063, "secen", LAMBDA, 4, -1, -1, NULL},
-                {064, "šobaltdien", LAMBDA, 9, -1, -1, NULL},
-                {065, "kādudien", LAMBDA, 7, -1, -1, NULL},
-                {066, "citudien", LAMBDA, 7, -1, -1, NULL},
-                {067, "daždien", LAMBDA, 6, -1, -1, NULL},
-                {070, "mūždien", LAMBDA, 6, -1, -1, NULL},
-                {071, "arvien", LAMBDA, 5, -1, -1, NULL},
-                {072, "aizvien", LAMBDA, 6, -1, -1, NULL},
-                {073, "varen", LAMBDA, 4, -1, -1, NULL},
-                {074, "sen", LAMBDA, 2, -1, -1, NULL},
-                {075, "pasen", LAMBDA, 4, -1, -1, NULL},
-                {076, "nesen", LAMBDA, 4, -1, -1, NULL},
-                {077, "bāztin", LAMBDA, 5, -1, -1, NULL},
-                {000,  NULL,        NULL,    0,  0,  0,  NULL},
+                {001, U16("pēkšņi"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {002, U16("respektīvi"), LAMBDA, 9, -1, -1, NO_CONDITION},
+                {003, U16("līdzi"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {004, U16("pretī"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {005, U16("labāk"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {006, U16("pēcāk"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {007, U16("citādāk"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {010, U16("savādāk"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {011, U16("turpmāk"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {012, U16("pārāk"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {013, U16("agrāk"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {014, U16("vairāk"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {015, U16("visvairāk"), LAMBDA, 8, -1, -1, NO_CONDITION},
+                {016, U16("mazāk"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {017, U16("drīzāk"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {020, U16("visbiežāk"), LAMBDA, 8, -1, -1, NO_CONDITION},
+                {021, U16("cik"), LAMBDA, 2, -1, -1, NO_CONDITION},
+                {022, U16("necik"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {023, U16("šitik"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {024, U16("atkal"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {025, U16("tūdaļ"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {026, U16("pakaļ"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {027, U16("iepakaļ"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {030, U16("nopakaļ"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {031, U16("visnotaļ"), LAMBDA, 7, -1, -1, NO_CONDITION},
+                {032, U16("atpakaļ"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {033, U16("palaikam"), LAMBDA, 7, -1, -1, NO_CONDITION},
+                {034, U16("aplam"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {035, U16("piemēram"), LAMBDA, 7, -1, -1, NO_CONDITION},
+                {036, U16("apmēram"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {037, U16("nepagalam"), LAMBDA, 8, -1, -1, NO_CONDITION},
+                {040, U16("pavisam"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {041, U16("nepavisam"), LAMBDA, 8, -1, -1, NO_CONDITION},
+                {042, U16("paretam"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {043, U16("šimbrīžam"), LAMBDA, 8, -1, -1, NO_CONDITION},
+                {044, U16("joprojām"), LAMBDA, 7, -1, -1, NO_CONDITION},
+                {045, U16("aumaļām"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {046, U16("lēnām"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {047, U16("pamazām"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {050, U16("gaužām"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {051, U16("aizgūtnēm"), LAMBDA, 8, -1, -1, NO_CONDITION},
+                {052, U16("pārpārēm"), LAMBDA, 7, -1, -1, NO_CONDITION},
+                {053, U16("caurcaurēm"), LAMBDA, 9, -1, -1, NO_CONDITION},
+                {054, U16("pamazītēm"), LAMBDA, 8, -1, -1, NO_CONDITION},
+                {055, U16("pretim"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {056, U16("iepretim"), LAMBDA, 7, -1, -1, NO_CONDITION},
+                {057, U16("prom"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {060, U16("patlaban"), LAMBDA, 7, -1, -1, NO_CONDITION},
+                {061, U16("diezgan"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {062, U16("šeitan"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {063, U16("secen"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {064, U16("šobaltdien"), LAMBDA, 9, -1, -1, NO_CONDITION},
+                {065, U16("kādudien"), LAMBDA, 7, -1, -1, NO_CONDITION},
+                {066, U16("citudien"), LAMBDA, 7, -1, -1, NO_CONDITION},
+                {067, U16("daždien"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {070, U16("mūždien"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {071, U16("arvien"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {072, U16("aizvien"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {073, U16("varen"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {074, U16("sen"), LAMBDA, 2, -1, -1, NO_CONDITION},
+                {075, U16("pasen"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {076, U16("nesen"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {077, U16("bāztin"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {000,  {NULL, 0},        {NULL, 0},    0,  0,  0,  NO_CONDITION},
            };
 
 
-static RuleList step0m_rules[] =
+static const PorterRule step0m_rules[] =
            {
-                {001, "drusciņ", LAMBDA, 6, -1, -1, NULL},
-                {002, "mazdrusciņ", LAMBDA, 9, -1, -1, NULL},
-                {003, "tūliņ", LAMBDA, 4, -1, -1, NULL},
-                {004, "mazlietiņ", LAMBDA, 8, -1, -1, NULL},
-                {005, "neparko", LAMBDA, 6, -1, -1, NULL},
-                {006, "vienkop", LAMBDA, 6, -1, -1, NULL},
-                {007, "kurp", LAMBDA, 3, -1, -1, NULL},
-                {010, "šurp", LAMBDA, 3, -1, -1, NULL},
-                {011, "turp", LAMBDA, 3, -1, -1, NULL},
-                {012, "vispār", LAMBDA, 5, -1, -1, NULL},
-                {013, "viscaur", LAMBDA, 6, -1, -1, NULL},
-                {014, "jebkur", LAMBDA, 5, -1, -1, NULL},
-                {015, "nekur", LAMBDA, 4, -1, -1, NULL},
-                {016, "visur", LAMBDA, 4, -1, -1, NULL},
-                {017, "šur", LAMBDA, 2, -1, -1, NULL},
-                {020, "tur", LAMBDA, 2, -1, -1, NULL},
-                {021, "citur", LAMBDA, 4, -1, -1, NULL},
-                {022, "vietumis", LAMBDA, 7, -1, -1, NULL},
-                {023, "retumis", LAMBDA, 6, -1, -1, NULL},
-                {024, "reizumis", LAMBDA, 7, -1, -1, NULL},
-                {025, "sensenis", LAMBDA, 7, -1, -1, NULL},
-                {026, "vairs", LAMBDA, 4, -1, -1, NULL},
-                {027, "papildus", LAMBDA, 7, -1, -1, NULL},
-                {030, "pārmijus", LAMBDA, 7, -1, -1, NULL},
-                {031, "blakus", LAMBDA, 5, -1, -1, NULL},
-                {032, "ieblakus", LAMBDA, 7, -1, -1, NULL},
-                {033, "līdztekus", LAMBDA, 8, -1, -1, NULL},
-                {034, "aplinkus", LAMBDA, 7, -1, -1, NULL},
-                {035, "izklaidus", LAMBDA, 8, -1, -1, NULL},
-                {036, "vienlaidus", LAMBDA, 9, -1, -1, NULL},
-                {037, "neviļus", LAMBDA, 6, -1, -1, NULL},
-                {040, "abpus", LAMBDA, 4, -1, -1, NULL},
-                {041, "vienpus", LAMBDA, 5, -1, -1, NULL},
-                {042, "katrpus", LAMBDA, 6, -1, -1, NULL},
-                {043, "otrpus", LAMBDA, 5, -1, -1, NULL},
-                {044, "virspus", LAMBDA, 6, -1, -1, NULL},
-                {045, "papriekš", LAMBDA, 7, -1, -1, NULL},
-                {046, "iepriekš", LAMBDA, 7, -1, -1, NULL},
-                {047, "klāt", LAMBDA, 3, -1, -1, NULL},
-                {050, "labprāt", LAMBDA, 6, -1, -1, NULL},
-                {051, "nelabprāt", LAMBDA, 8, -1, -1, NULL},
-                {052, "manuprāt", LAMBDA, 7, -1, -1, NULL},
-                {053, "mūsuprāt", LAMBDA, 7, -1, -1, NULL},
-                {054, "tīšuprāt", LAMBDA, 7, -1, -1, NULL},
-                {055, "tavuprāt", LAMBDA, 7, -1, -1, NULL},
-                {056, "ciet", LAMBDA, 3, -1, -1, NULL},
-                {057, "mazliet", LAMBDA, 5, -1, -1, NULL},
-                {060, "vienviet", LAMBDA, 7, -1, -1, NULL},
-                {061, "vienuviet", LAMBDA, 8, -1, -1, NULL},
-                {062, "dažviet", LAMBDA, 6, -1, -1, NULL},
-                {063, "beidzot", LAMBDA, 6, -1, -1, NULL},
-                {064, "visbeidzot", LAMBDA, 9,-1,-1, NULL},
-                {065, "vairākkārt", LAMBDA, 9, -1, -1, NULL},
-                {066, "pirmkārt", LAMBDA, 7, -1, -1, NULL},
-                {067, "vienkārt", LAMBDA, 7, -1, -1, NULL},
-                {070, "galvenokārt", LAMBDA, 10, -1, -1, NULL},
-                {071, "apkārt", LAMBDA, 5, -1, -1, NULL},
-                {072, "visapkārt", LAMBDA, 8, -1, -1, NULL},
-                {073, "citkārt", LAMBDA, 6, -1, -1, NULL},
-                {074, "daudzkārt", LAMBDA, 8, -1, -1, NULL},
-                {075, "dažkārt", LAMBDA, 6, -1, -1, NULL},
-                {076, "nost", LAMBDA, 3, -1, -1, NULL},
-                {077, "pārlieku", LAMBDA, 7, -1, -1, NULL},
-                {000,  NULL,        NULL,    0,  0,  0,  NULL},
+                {001, U16("drusciņ"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {002, U16("mazdrusciņ"), LAMBDA, 9, -1, -1, NO_CONDITION},
+                {003, U16("tūliņ"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {004, U16("mazlietiņ"), LAMBDA, 8, -1, -1, NO_CONDITION},
+                {005, U16("neparko"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {006, U16("vienkop"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {007, U16("kurp"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {010, U16("šurp"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {011, U16("turp"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {012, U16("vispār"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {013, U16("viscaur"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {014, U16("jebkur"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {015, U16("nekur"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {016, U16("visur"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {017, U16("šur"), LAMBDA, 2, -1, -1, NO_CONDITION},
+                {020, U16("tur"), LAMBDA, 2, -1, -1, NO_CONDITION},
+                {021, U16("citur"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {022, U16("vietumis"), LAMBDA, 7, -1, -1, NO_CONDITION},
+                {023, U16("retumis"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {024, U16("reizumis"), LAMBDA, 7, -1, -1, NO_CONDITION},
+                {025, U16("sensenis"), LAMBDA, 7, -1, -1, NO_CONDITION},
+                {026, U16("vairs"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {027, U16("papildus"), LAMBDA, 7, -1, -1, NO_CONDITION},
+                {030, U16("pārmijus"), LAMBDA, 7, -1, -1, NO_CONDITION},
+                {031, U16("blakus"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {032, U16("ieblakus"), LAMBDA, 7, -1, -1, NO_CONDITION},
+                {033, U16("līdztekus"), LAMBDA, 8, -1, -1, NO_CONDITION},
+                {034, U16("aplinkus"), LAMBDA, 7, -1, -1, NO_CONDITION},
+                {035, U16("izklaidus"), LAMBDA, 8, -1, -1, NO_CONDITION},
+                {036, U16("vienlaidus"), LAMBDA, 9, -1, -1, NO_CONDITION},
+                {037, U16("neviļus"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {040, U16("abpus"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {041, U16("vienpus"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {042, U16("katrpus"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {043, U16("otrpus"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {044, U16("virspus"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {045, U16("papriekš"), LAMBDA, 7, -1, -1, NO_CONDITION},
+                {046, U16("iepriekš"), LAMBDA, 7, -1, -1, NO_CONDITION},
+                {047, U16("klāt"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {050, U16("labprāt"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {051, U16("nelabprāt"), LAMBDA, 8, -1, -1, NO_CONDITION},
+                {052, U16("manuprāt"), LAMBDA, 7, -1, -1, NO_CONDITION},
+                {053, U16("mūsuprāt"), LAMBDA, 7, -1, -1, NO_CONDITION},
+                {054, U16("tīšuprāt"), LAMBDA, 7, -1, -1, NO_CONDITION},
+                {055, U16("tavuprāt"), LAMBDA, 7, -1, -1, NO_CONDITION},
+                {056, U16("ciet"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {057, U16("mazliet"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {060, U16("vienviet"), LAMBDA, 7, -1, -1, NO_CONDITION},
+                {061, U16("vienuviet"), LAMBDA, 8, -1, -1, NO_CONDITION},
+                {062, U16("dažviet"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {063, U16("beidzot"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {064, U16("visbeidzot"), LAMBDA, 9,-1,-1, NO_CONDITION},
+                {065, U16("vairākkārt"), LAMBDA, 9, -1, -1, NO_CONDITION},
+                {066, U16("pirmkārt"), LAMBDA, 7, -1, -1, NO_CONDITION},
+                {067, U16("vienkārt"), LAMBDA, 7, -1, -1, NO_CONDITION},
+                {070, U16("galvenokārt"), LAMBDA, 10, -1, -1, NO_CONDITION},
+                {071, U16("apkārt"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {072, U16("visapkārt"), LAMBDA, 8, -1, -1, NO_CONDITION},
+                {073, U16("citkārt"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {074, U16("daudzkārt"), LAMBDA, 8, -1, -1, NO_CONDITION},
+                {075, U16("dažkārt"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {076, U16("nost"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {077, U16("pārlieku"), LAMBDA, 7, -1, -1, NO_CONDITION},
+                {000,  {NULL, 0},        {NULL, 0},    0,  0,  0,  NO_CONDITION},
            };
 
-static RuleList step0n_rules[] =
+static const PorterRule step0n_rules[] =
            {
-                {001, "šiet", LAMBDA, 3, -1, -1, NULL},
-                {002, "tūlīt", LAMBDA, 4, -1, -1, NULL},
-                {003, "pirmīt", LAMBDA, 5, -1, -1, NULL},
-                {004, "maķenīt", LAMBDA, 6, -1, -1, NULL},
-                {005, "atstatu", LAMBDA, 6, -1, -1, NULL},
-                {006, "maz", LAMBDA, 2, -1, -1, NULL},
-                {007, "pamaz", LAMBDA, 4, -1, -1, NULL},
-                {010, "nemaz", LAMBDA, 4, -1, -1, NULL},
-                {011, "vismaz", LAMBDA, 5, -1, -1, NULL},
-                {012, "daudzmaz", LAMBDA, 7, -1, -1, NULL},
-                {013, "bezmaz", LAMBDA, 5, -1, -1, NULL},
-                {014, "vienlīdz", LAMBDA, 7, -1, -1, NULL},
-                {015, "puslīdz", LAMBDA, 6, -1, -1, NULL},
-                {016, "daudz", LAMBDA, 4, -1, -1, NULL},
-                {017, "nedaudz", LAMBDA, 6, -1, -1, NULL},
-                {020, "reiz", LAMBDA, 3, -1, -1, NULL},
-                {021, "ikreiz", LAMBDA, 5, -1, -1, NULL},
-                {022, "kādreiz", LAMBDA, 6, -1, -1, NULL},
-                {023, "vairākreiz", LAMBDA, 9, -1, -1, NULL},
-                {024, "cikreiz", LAMBDA, 6, -1, -1, NULL},
-                {025, "tikreiz", LAMBDA, 6, -1, -1, NULL},
-                {026, "vēlreiz", LAMBDA, 6, -1, -1, NULL},
-                {027, "nākamreiz", LAMBDA, 8, -1, -1, NULL},
-                {030, "viņreiz", LAMBDA, 6, -1, -1, NULL},
-                {031, "šoreiz", LAMBDA, 5, -1, -1, NULL},
-                {032, "toreiz", LAMBDA, 5, -1, -1, NULL},
-                {033, "pašreiz", LAMBDA, 6, -1, -1, NULL},
-                {034, "nākošreiz", LAMBDA, 8, -1, -1, NULL},
-                {035, "citreiz", LAMBDA, 6, -1, -1, NULL},
-                {036, "citureiz", LAMBDA, 7, -1, -1, NULL},
-                {037, "daudzreiz", LAMBDA, 8, -1, -1, NULL},
-                {040, "uzreiz", LAMBDA, 5, -1, -1, NULL},
-                {041, "dažreiz", LAMBDA, 6, -1, -1, NULL},
-                {042, "drīz", LAMBDA, 3, -1, -1, NULL},
-                {043, "gandrīz", LAMBDA, 6, -1, -1, NULL},
-                {044, "allaž", LAMBDA, 4, -1, -1, NULL},
-                {000,  NULL,        NULL,    0,  0,  0,  NULL},
+                {001, U16("šiet"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {002, U16("tūlīt"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {003, U16("pirmīt"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {004, U16("maķenīt"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {005, U16("atstatu"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {006, U16("maz"), LAMBDA, 2, -1, -1, NO_CONDITION},
+                {007, U16("pamaz"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {010, U16("nemaz"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {011, U16("vismaz"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {012, U16("daudzmaz"), LAMBDA, 7, -1, -1, NO_CONDITION},
+                {013, U16("bezmaz"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {014, U16("vienlīdz"), LAMBDA, 7, -1, -1, NO_CONDITION},
+                {015, U16("puslīdz"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {016, U16("daudz"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {017, U16("nedaudz"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {020, U16("reiz"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {021, U16("ikreiz"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {022, U16("kādreiz"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {023, U16("vairākreiz"), LAMBDA, 9, -1, -1, NO_CONDITION},
+                {024, U16("cikreiz"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {025, U16("tikreiz"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {026, U16("vēlreiz"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {027, U16("nākamreiz"), LAMBDA, 8, -1, -1, NO_CONDITION},
+                {030, U16("viņreiz"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {031, U16("šoreiz"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {032, U16("toreiz"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {033, U16("pašreiz"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {034, U16("nākošreiz"), LAMBDA, 8, -1, -1, NO_CONDITION},
+                {035, U16("citreiz"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {036, U16("citureiz"), LAMBDA, 7, -1, -1, NO_CONDITION},
+                {037, U16("daudzreiz"), LAMBDA, 8, -1, -1, NO_CONDITION},
+                {040, U16("uzreiz"), LAMBDA, 5, -1, -1, NO_CONDITION},
+                {041, U16("dažreiz"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {042, U16("drīz"), LAMBDA, 3, -1, -1, NO_CONDITION},
+                {043, U16("gandrīz"), LAMBDA, 6, -1, -1, NO_CONDITION},
+                {044, U16("allaž"), LAMBDA, 4, -1, -1, NO_CONDITION},
+                {000,  {NULL, 0},        {NULL, 0},    0,  0,  0,  NO_CONDITION},
            };
 
 
-static RuleList step1a_rules[] =
+static const PorterRule step1a_rules[] =
            {
-                {100, "ies", LAMBDA, 2, -1, 0, NULL},
-                {101, "iem", LAMBDA, 2, -1, -1, NULL},
-                {102, "ām", LAMBDA, 1, -1, -1, NULL},
-                {103, "am", LAMBDA, 1, -1, -1, NULL},
-                {104, "ēm", LAMBDA, 1, -1, -1, NULL},
-                {000,  NULL,        NULL,    0,  0,  0,  NULL},
+                {100, U16("ies"), LAMBDA, 2, -1, 0, NO_CONDITION},
+                {101, U16("iem"), LAMBDA, 2, -1, -1, NO_CONDITION},
+                {102, U16("ām"), LAMBDA, 1, -1, -1, NO_CONDITION},
+                {103, U16("am"), LAMBDA, 1, -1, -1, NO_CONDITION},
+                {104, U16("ēm"), LAMBDA, 1, -1, -1, NO_CONDITION},
+                {000,  {NULL, 0},        {NULL, 0},    0,  0,  0,  NO_CONDITION},
            };
 
-static RuleList step1a1_rules[] =
+static const PorterRule step1a1_rules[] =
            {
-                {100, "em", LAMBDA, 1, -1, -1, NULL},
-                {101, "īm", LAMBDA, 1, -1, -1, NULL},
-                {102, "im", LAMBDA, 1, -1, -1, NULL},
-                {103, "um", LAMBDA, 1, -1, -1, NULL},
-                {104, "us", LAMBDA, 1, -1, -1, NULL},
-                {000,  NULL,        NULL,    0,  0,  0,  NULL},
+                {100, U16("em"), LAMBDA, 1, -1, -1, NO_CONDITION},
+                {101, U16("īm"), LAMBDA, 1, -1, -1, NO_CONDITION},
+                {102, U16("im"), LAMBDA, 1, -1, -1, NO_CONDITION},
+                {103, U16("um"), LAMBDA, 1, -1, -1, NO_CONDITION},
+                {104, U16("us"), LAMBDA, 1, -1, -1, NO_CONDITION},
+                {000,  {NULL, 0},        {NULL, 0},    0,  0,  0,  NO_CONDITION},
            };
 
 
-static RuleList step1a2_rules[] =
+static const PorterRule step1a2_rules[] =
            {
-                {100, "as", LAMBDA, 1, -1, -1, NULL},
-                {101, "es", LAMBDA, 1, -1, -1, NULL},
-                {102, "u", LAMBDA, 0, -1, -1, NULL},
-                {103, "os", LAMBDA, 1, -1, -1, NULL},
-                {104, "ai", LAMBDA, 1, -1, -1, NULL},
-                {000,  NULL,        NULL,    0,  0,  0,  NULL},
+                {100, U16("as"), LAMBDA, 1, -1, -1, NO_CONDITION},
+                {101, U16("es"), LAMBDA, 1, -1, -1, NO_CONDITION},
+                {102, U16("u"), LAMBDA, 0, -1, -1, NO_CONDITION},
+                {103, U16("os"), LAMBDA, 1, -1, -1, NO_CONDITION},
+                {104, U16("ai"), LAMBDA, 1, -1, -1, NO_CONDITION},
+                {000,  {NULL, 0},        {NULL, 0},    0,  0,  0,  NO_CONDITION},
            };
 
-static RuleList step1a3_rules[] =
+static const PorterRule step1a3_rules[] =
            {
-                {100, "t", LAMBDA, 0, -1, 0, NULL},
-                {101, "u", LAMBDA, 0, -1, 0, NULL},
-                {102, "ei", LAMBDA, 1, -1, -1, NULL},
-                {103, "ij", LAMBDA, 1, -1, -1, NULL},
-                {104, "is", LAMBDA, 1, -1, -1, NULL},
-                {000,  NULL,        NULL,    0,  0,  0,  NULL},
+                {100, U16("t"), LAMBDA, 0, -1, 0, NO_CONDITION},
+                {101, U16("u"), LAMBDA, 0, -1, 0, NO_CONDITION},
+                {102, U16("ei"), LAMBDA, 1, -1, -1, NO_CONDITION},
+                {103, U16("ij"), LAMBDA, 1, -1, -1, NO_CONDITION},
+                {104, U16("is"), LAMBDA, 1, -1, -1, NO_CONDITION},
+                {000,  {NULL, 0},        {NULL, 0},    0,  0,  0,  NO_CONDITION},
            };
 
-static RuleList step1a4_rules[] =
+static const PorterRule step1a4_rules[] =
            {
-                {100, "ēs", LAMBDA, 1, -1, -1, NULL},
-                {101, "is", LAMBDA, 1, -1, -1, NULL},
-                {102, "ais", LAMBDA, 2, -1, -1, NULL},
-                {103, "ie", LAMBDA, 1, -1, -1, NULL},
-                {104, "s", LAMBDA, 0, -1, -1, NULL},
-                {000,  NULL,        NULL,    0,  0,  0,  NULL},
+                {100, U16("ēs"), LAMBDA, 1, -1, -1, NO_CONDITION},
+                {101, U16("is"), LAMBDA, 1, -1, -1, NO_CONDITION},
+                {102, U16("ais"), LAMBDA, 2, -1, -1, NO_CONDITION},
+                {103, U16("ie"), LAMBDA, 1, -1, -1, NO_CONDITION},
+                {104, U16("s"), LAMBDA, 0, -1, -1, NO_CONDITION},
+                {000,  {NULL, 0},        {NULL, 0},    0,  0,  0,  NO_CONDITION},
            };
 
-static RuleList step1a5_rules[] =
+static const PorterRule step1a5_rules[] =
            {
-                {100, "š", LAMBDA, 0, -1, -1, NULL},
-                {101, "a", LAMBDA, 0, -1, 0, NULL},
-                {102, "i", LAMBDA, 0, -1, -1, NULL},
-                {103, "e", LAMBDA, 0, -1, -1, NULL},
-                {104, "ā", LAMBDA, 0, -1, 0, NULL},
-                {000,  NULL,        NULL,    0,  0,  0,  NULL},
+                {100, U16("š"), LAMBDA, 0, -1, -1, NO_CONDITION},
+                {101, U16("a"), LAMBDA, 0, -1, 0, NO_CONDITION},
+                {102, U16("i"), LAMBDA, 0, -1, -1, NO_CONDITION},
+                {103, U16("e"), LAMBDA, 0, -1, -1, NO_CONDITION},
+                {104, U16("ā"), LAMBDA, 0, -1, 0, NO_CONDITION},
+                {000,  {NULL, 0},        {NULL, 0},    0,  0,  0,  NO_CONDITION},
            };
 
-static RuleList step1a6_rules[] =
+static const PorterRule step1a6_rules[] =
            {
-                {100, "ē", LAMBDA, 0, -1, 0, NULL},
-                {101, "ī", LAMBDA, 0, -1, 0, NULL},
-                {102, "ū", LAMBDA, 0, -1, 0, NULL},
-                {103, "o", LAMBDA, 0, -1, 0, NULL},
-                {000,  NULL,        NULL,    0,  0,  0,  NULL},
+                {100, U16("ē"), LAMBDA, 0, -1, 0, NO_CONDITION},
+                {101, U16("ī"), LAMBDA, 0, -1, 0, NO_CONDITION},
+                {102, U16("ū"), LAMBDA, 0, -1, 0, NO_CONDITION},
+                {103, U16("o"), LAMBDA, 0, -1, 0, NO_CONDITION},
+                {000,  {NULL, 0},        {NULL, 0},    0,  0,  0,  NO_CONDITION},
            };
 
-static RuleList step1b1_rules[] =
+static const PorterRule step1b1_rules[] =
            {
-                {108,  "pj",        "p",   1,  0, -1,  NULL},
-                {109,  "bj",        "b",   1,  0, -1,  NULL},
-                {110,  "mj",        "m",   1,  0, -1,  NULL},
-                {111,  "vj",        "v",     1,  0, -1,  NULL},
-                {112,  "šļ",        "sl",     1,  0, -1,  NULL},
-                {113,  "žņ",        "zn",     1,  0, -1,  NULL},
-                {114,  "dž",        "dz",     1,  0, 1,  NULL},
-                {115,  "šņ",        "sn",     1,  0, 0,  NULL},
-                {116,  "žļ",        "zl",     1,  0, -1,  NULL},
-                {117,  "ļņ",        "ln",     1,  0, -1,  NULL},
-                {000,  NULL,        NULL,    0,  0,  0,  NULL},
+                {108,  U16("pj"),        U16("p"),   1,  0, -1,  NO_CONDITION},
+                {109,  U16("bj"),        U16("b"),   1,  0, -1,  NO_CONDITION},
+                {110,  U16("mj"),        U16("m"),   1,  0, -1,  NO_CONDITION},
+                {111,  U16("vj"),        U16("v"),     1,  0, -1,  NO_CONDITION},
+                {112,  U16("šļ"),        U16("sl"),     1,  0, -1,  NO_CONDITION},
+                {113,  U16("žņ"),        U16("zn"),     1,  0, -1,  NO_CONDITION},
+                {114,  U16("dž"),        U16("dz"),     1,  0, 1,  NO_CONDITION},
+                {115,  U16("šņ"),        U16("sn"),     1,  0, 0,  NO_CONDITION},
+                {116,  U16("žļ"),        U16("zl"),     1,  0, -1,  NO_CONDITION},
+                {117,  U16("ļņ"),        U16("ln"),     1,  0, -1,  NO_CONDITION},
+                {000,  {NULL, 0},        {NULL, 0},    0,  0,  0,  NO_CONDITION},
             };
 
-static RuleList step2_rules[] =
+static const PorterRule step2_rules[] =
            {
-                {203, "acionāl", "acion", 6, 3, 0, NULL},
-                {204, "ācij", "āc", 3, 1, 0, NULL},
-                {205, "ārij", "ār" ,3, 1, 0, NULL},
-                {206, "iecīb", "iec", 4, 2, 0, NULL},
-                {207, "ainīb", "ain", 4, 2, 0, NULL},
-                {208, "ādīb", "ād", 3, 1, 0, NULL},
-                {209, "ātīb", "āt", 3, 1, 0, NULL},
-                {210, "dzīb", "dz", 3, 1, 0, NULL},
-                {211, "āfij", "āf", 3, 1, 0, NULL},
-                {212, "omij", "om", 3, 1, 0, NULL},
-                {213, "oģij", "oģ", 3, 1, 0, NULL},
-                {214, "orij", "or" ,3, 1, 0, NULL},
-                {000,  NULL,        NULL,    0,  0,  0,  NULL},
+                {203, U16("acionāl"), U16("acion"), 6, 3, 0, NO_CONDITION},
+                {204, U16("ācij"), U16("āc"), 3, 1, 0, NO_CONDITION},
+                {205, U16("ārij"), U16("ār") ,3, 1, 0, NO_CONDITION},
+                {206, U16("iecīb"), U16("iec"), 4, 2, 0, NO_CONDITION},
+                {207, U16("ainīb"), U16("ain"), 4, 2, 0, NO_CONDITION},
+                {208, U16("ādīb"), U16("ād"), 3, 1, 0, NO_CONDITION},
+                {209, U16("ātīb"), U16("āt"), 3, 1, 0, NO_CONDITION},
+                {210, U16("dzīb"), U16("dz"), 3, 1, 0, NO_CONDITION},
+                {211, U16("āfij"), U16("āf"), 3, 1, 0, NO_CONDITION},
+                {212, U16("omij"), U16("om"), 3, 1, 0, NO_CONDITION},
+                {213, U16("oģij"), U16("oģ"), 3, 1, 0, NO_CONDITION},
+                {214, U16("orij"), U16("or") ,3, 1, 0, NO_CONDITION},
+                {000,  {NULL, 0},        {NULL, 0},    0,  0,  0,  NO_CONDITION},
             };
 
-static RuleList step3_rules[] =
+static const PorterRule step3_rules[] =
            {
-                {301, "iek", LAMBDA, 2, -1, 1, NULL},
-                {302, "iec", LAMBDA, 2, -1, 1, NULL},
-                {303, "niek", LAMBDA, 3, -1, 0, NULL},
-                {304, "niec", LAMBDA, 3, -1, 0, NULL},
-                {305, "nīc", LAMBDA, 2, -1, 1, NULL},
-                {306, "ain", LAMBDA, 2, -1, 0, NULL},
-                {307, "ant", LAMBDA, 2, -1, 2, NULL},
-                {308, "ier", LAMBDA, 2, -1, 1, NULL},
-                {309, "iet", LAMBDA, 2, -1, 1, NULL},
-                {310, "inā", LAMBDA, 2, -1, 1, NULL},
-                {311, "ing", LAMBDA, 2, -1, 1, NULL},
-                {312, "ism", LAMBDA, 2, -1, 1, NULL},
-                {313, "isk", LAMBDA, 2, -1, 0, NULL},
-                {314, "ist", LAMBDA, 2, -1, 1, NULL},
-                {315, "šan", LAMBDA, 2, -1, 0, NULL},
-                {316, "iem", LAMBDA, 2, -1, 1, NULL},
-                {317, "ām", LAMBDA, 1, -1, 1, NULL},
-                {318, "am", LAMBDA, 1, -1, 2, NULL},
-                {319, "ēm", LAMBDA, 1, -1, 1, NULL},
-                {320, "em", LAMBDA, 1, -1, 2, NULL},
-                {321, "īm", LAMBDA, 1, -1, 2, NULL},
-                {322, "im", LAMBDA, 1, -1, 2, NULL},
-                {323, "um", LAMBDA, 1, -1, 2, NULL},
-                {000,  NULL,        NULL,    0,  0,  0,  NULL},
+                {301, U16("iek"), LAMBDA, 2, -1, 1, NO_CONDITION},
+                {302, U16("iec"), LAMBDA, 2, -1, 1, NO_CONDITION},
+                {303, U16("niek"), LAMBDA, 3, -1, 0, NO_CONDITION},
+                {304, U16("niec"), LAMBDA, 3, -1, 0, NO_CONDITION},
+                {305, U16("nīc"), LAMBDA, 2, -1, 1, NO_CONDITION},
+                {306, U16("ain"), LAMBDA, 2, -1, 0, NO_CONDITION},
+                {307, U16("ant"), LAMBDA, 2, -1, 2, NO_CONDITION},
+                {308, U16("ier"), LAMBDA, 2, -1, 1, NO_CONDITION},
+                {309, U16("iet"), LAMBDA, 2, -1, 1, NO_CONDITION},
+                {310, U16("inā"), LAMBDA, 2, -1, 1, NO_CONDITION},
+                {311, U16("ing"), LAMBDA, 2, -1, 1, NO_CONDITION},
+                {312, U16("ism"), LAMBDA, 2, -1, 1, NO_CONDITION},
+                {313, U16("isk"), LAMBDA, 2, -1, 0, NO_CONDITION},
+                {314, U16("ist"), LAMBDA, 2, -1, 1, NO_CONDITION},
+                {315, U16("šan"), LAMBDA, 2, -1, 0, NO_CONDITION},
+                {316, U16("iem"), LAMBDA, 2, -1, 1, NO_CONDITION},
+                {317, U16("ām"), LAMBDA, 1, -1, 1, NO_CONDITION},
+                {318, U16("am"), LAMBDA, 1, -1, 2, NO_CONDITION},
+                {319, U16("ēm"), LAMBDA, 1, -1, 1, NO_CONDITION},
+                {320, U16("em"), LAMBDA, 1, -1, 2, NO_CONDITION},
+                {321, U16("īm"), LAMBDA, 1, -1, 2, NO_CONDITION},
+                {322, U16("im"), LAMBDA, 1, -1, 2, NO_CONDITION},
+                {323, U16("um"), LAMBDA, 1, -1, 2, NO_CONDITION},
+                {000,  {NULL, 0},        {NULL, 0},    0,  0,  0,  NO_CONDITION},
             };
 
 
-static RuleList step4_rules[] =
+static const PorterRule step4_rules[] =
            {
-                {401, "āb", LAMBDA, 1, -1, 2, NULL},
-                {402, "ād", LAMBDA, 1, -1, 1, NULL},
-                {403, "āj", LAMBDA, 1, -1, 1, NULL},
-                {404, "āl", LAMBDA, 1, -1, 3, NULL},
-                {405, "ān", LAMBDA, 1, -1, 1, NULL},
-                {406, "ār", LAMBDA, 1, -1, 1, NULL},
-                {407, "āt", LAMBDA, 1, -1, 1, NULL},
-                {408, "āz", LAMBDA, 1, -1, 1, NULL},
-                {409, "āž", LAMBDA, 1, -1, 1, NULL},
-                {410, "al", LAMBDA, 1, -1, 2, NULL},
-                {411, "av", LAMBDA, 1, -1, 1, NULL},
-                {412, "ēj", LAMBDA, 1, -1, 2, NULL},
-                {413, "ēk", LAMBDA, 1, -1, 1, NULL},
-                {414, "ēt", LAMBDA, 1, -1, 1, NULL},
-                {415, "ēz", LAMBDA, 1, -1, 1, NULL},
-                {416, "ej", LAMBDA, 1, -1, 1, NULL},
-                {417, "el", LAMBDA, 1, -1, 3, NULL},
-                {418, "er", LAMBDA, 1, -1, 2, NULL},
-                {419, "īb", LAMBDA, 1, -1, 1, NULL},
-                {420, "īc", LAMBDA, 1, -1, 1, NULL},
-                {421, "īd", LAMBDA, 1, -1, 3, NULL},
-                {422, "īg", LAMBDA, 1, -1, 1, NULL},
-                {423, "īj", LAMBDA, 1, -1, 1, NULL},
-                {424, "īt", LAMBDA, 1, -1, 2, NULL},
-                {425, "īv", LAMBDA, 1, -1, 2, NULL},
-                {426, "īz", LAMBDA, 1, -1, 1, NULL},
-                {427, "ij", LAMBDA, 1, -1, 1, NULL},
-                {428, "il", LAMBDA, 1, -1, 2, NULL},
-                {429, "ik", LAMBDA, 1, -1, 2, NULL},
-                {430, "iņ", LAMBDA, 1, -1, 1, NULL},
-                {431, "ol", LAMBDA, 1, -1, 2, NULL},
-                {432, "oņ", LAMBDA, 1, -1, 0, NULL},
-                {433, "on", LAMBDA, 1, -1, 1, NULL},
-                {434, "or", LAMBDA, 1, -1, 1, NULL},
-                {435, "ot", LAMBDA, 1, -1, 1, NULL},
-                {436, "ul", LAMBDA, 1, -1, 2, NULL},
-                {437, "īn", LAMBDA, 1, -1, 0, NULL},
-                {438, "aj", LAMBDA, 1, -1, 0, NULL},
-                {000,  NULL,        NULL,    0,  0,  0,  NULL},
+                {401, U16("āb"), LAMBDA, 1, -1, 2, NO_CONDITION},
+                {402, U16("ād"), LAMBDA, 1, -1, 1, NO_CONDITION},
+                {403, U16("āj"), LAMBDA, 1, -1, 1, NO_CONDITION},
+                {404, U16("āl"), LAMBDA, 1, -1, 3, NO_CONDITION},
+                {405, U16("ān"), LAMBDA, 1, -1, 1, NO_CONDITION},
+                {406, U16("ār"), LAMBDA, 1, -1, 1, NO_CONDITION},
+                {407, U16("āt"), LAMBDA, 1, -1, 1, NO_CONDITION},
+                {408, U16("āz"), LAMBDA, 1, -1, 1, NO_CONDITION},
+                {409, U16("āž"), LAMBDA, 1, -1, 1, NO_CONDITION},
+                {410, U16("al"), LAMBDA, 1, -1, 2, NO_CONDITION},
+                {411, U16("av"), LAMBDA, 1, -1, 1, NO_CONDITION},
+                {412, U16("ēj"), LAMBDA, 1, -1, 2, NO_CONDITION},
+                {413, U16("ēk"), LAMBDA, 1, -1, 1, NO_CONDITION},
+                {414, U16("ēt"), LAMBDA, 1, -1, 1, NO_CONDITION},
+                {415, U16("ēz"), LAMBDA, 1, -1, 1, NO_CONDITION},
+                {416, U16("ej"), LAMBDA, 1, -1, 1, NO_CONDITION},
+                {417, U16("el"), LAMBDA, 1, -1, 3, NO_CONDITION},
+                {418, U16("er"), LAMBDA, 1, -1, 2, NO_CONDITION},
+                {419, U16("īb"), LAMBDA, 1, -1, 1, NO_CONDITION},
+                {420, U16("īc"), LAMBDA, 1, -1, 1, NO_CONDITION},
+                {421, U16("īd"), LAMBDA, 1, -1, 3, NO_CONDITION},
+                {422, U16("īg"), LAMBDA, 1, -1, 1, NO_CONDITION},
+                {423, U16("īj"), LAMBDA, 1, -1, 1, NO_CONDITION},
+                {424, U16("īt"), LAMBDA, 1, -1, 2, NO_CONDITION},
+                {425, U16("īv"), LAMBDA, 1, -1, 2, NO_CONDITION},
+                {426, U16("īz"), LAMBDA, 1, -1, 1, NO_CONDITION},
+                {427, U16("ij"), LAMBDA, 1, -1, 1, NO_CONDITION},
+                {428, U16("il"), LAMBDA, 1, -1, 2, NO_CONDITION},
+                {429, U16("ik"), LAMBDA, 1, -1, 2, NO_CONDITION},
+                {430, U16("iņ"), LAMBDA, 1, -1, 1, NO_CONDITION},
+                {431, U16("ol"), LAMBDA, 1, -1, 2, NO_CONDITION},
+                {432, U16("oņ"), LAMBDA, 1, -1, 0, NO_CONDITION},
+                {433, U16("on"), LAMBDA, 1, -1, 1, NO_CONDITION},
+                {434, U16("or"), LAMBDA, 1, -1, 1, NO_CONDITION},
+                {435, U16("ot"), LAMBDA, 1, -1, 1, NO_CONDITION},
+                {436, U16("ul"), LAMBDA, 1, -1, 2, NO_CONDITION},
+                {437, U16("īn"), LAMBDA, 1, -1, 0, NO_CONDITION},
+                {438, U16("aj"), LAMBDA, 1, -1, 0, NO_CONDITION},
+                {000,  {NULL, 0},        {NULL, 0},    0,  0,  0,  NO_CONDITION},
             };
 
-static RuleList step6_rules[] =
+static const PorterRule step6_rules[] =
            {
-                {601, "šun", "sun", 0,0,0, NULL},
-                {000,  NULL,        NULL,    0,  0,  0,  NULL},
+                {601, U16("šun"), U16("sun"), 0,0,0, NO_CONDITION},
+                {000,  {NULL, 0},        {NULL, 0},    0,  0,  0,  NO_CONDITION},
             };
 
+static const PorterRule *const step0_rules[] =
+           {
+                step0a_rules, step0b_rules, step0c_rules, step0d_rules,
+                step0e_rules, step0f_rules, step0g_rules, step0h_rules,
+                step0i_rules, step0j_rules, step0k_rules, step0l_rules,
+                step0m_rules, step0n_rules,
+                NULL,
+           };
+
+/* Steps in the order runSteps() runs them, step0 is the stop words */
+static const char *const step_names[] =
+           {
+             "step0", "step1a", "step1a1", "step1a2", "step1a3", "step1a4",
+             "step1a5", "step1a6", "step1b1", "step2", "step3", "step4",
+             "step6",
+           };
 
-static QString iflatv = QString("ĀāČčĒēĢģĪīĶķĻļŅņŠšŪūŽž");
-static QString Vlatv = QString("āīēū");
+#define STEP_COUNT  int(sizeof(step_names) / sizeof(step_names[0]))
 
-/*****************************************************************************/
-/********************   Private Function Declarations   **********************/
+#ifdef STEMMER_RULE_STATS
+/* Per rule counters, registered after the tables they point into */
+static RuleStats *rule_stats = CompileRuleStats();
+#endif
 
-static int IsLatVowel(QChar ch)
-{
-    if (IsVowel(ch))
-        return true;
-    else
-    {
-        return Vlatv.contains(ch);
-    }
-}/*IsLatVowel*/
 
-/*static int islatv(QChar ch)
-{
-    return iflatv.contains(ch);
-}*/
-
-/*FN***************************************************************************
-
-       WordSize( word )
-
-   Returns: int -- a weird count of word size in adjusted syllables
-
-   Purpose: Count syllables in a special way:  count the number
-            vowel-consonant pairs in a word, disregarding initial
-            consonants and final vowels.  The letter "y" counts as a
-            consonant at the beginning of a word and when it has a vowel
-            in front of it; otherwise (when it follows a consonant) it
-            is treated as a vowel.  For example, the WordSize of "cat"
-            is 1, of "any" is 1, of "amount" is 2, of "anything" is 3.
-
-   Plan:    Run a DFA to compute the word size
-
-   Notes:   The easiest and fastest way to compute this funny measure is
-            with a finite state machine.  The initial state 0 checks
-            the first letter.  If it is a vowel, then the machine changes
-            to state 1, which is the "last letter was a vowel" state.
-            If the first letter is a consonant or y, then it changes
-            to state 2, the "last letter was a consonant state".  In
-            state 1, a y is treated as a consonant (since it follows
-            a vowel), but in state 2, y is treated as a vowel (since
-            it follows a consonant.  The result counter is incremented
-            on the transition from state 1 to state 2, since this
-            transition only occurs after a vowel-consonant pair, which
-            is what we are counting.
+/*FN**************************************************************************
+
+       Tables()
+
+   Returns: const LVTables & -- the stop word set and the step tries
+
+   Purpose: Compile the tables on the first stem instead of before
+            main(), so a program that links the library but never
+            stems Latvian pays nothing.  A function local static is
+            built exactly once even when threads race to it.  The stop
+            word set points into the U16 literals of the step0 tables.
 **/
 
-static int WordSize( QString &word )
+static const LVTables &Tables()
 {
-    register int result;   /* WordSize of the word */
-    register int state;    /* current state in machine */
+    static const LVTables tables = {
+               LVEngine::compileWords( step0_rules ),
+               LVEngine::compileRules( step1a_rules ),
+               LVEngine::compileRules( step1a1_rules ),
+               LVEngine::compileRules( step1a2_rules ),
+               LVEngine::compileRules( step1a3_rules ),
+               LVEngine::compileRules( step1a4_rules ),
+               LVEngine::compileRules( step1a5_rules ),
+               LVEngine::compileRules( step1a6_rules ),
+               LVEngine::compileRules( step1b1_rules ),
+               LVEngine::compileRules( step2_rules ),
+               LVEngine::compileRules( step3_rules ),
+               LVEngine::compileRules( step4_rules ),
+               };
+
+    return tables;
+} /* Tables */
 
-    result = 0;
-    state = 0;
+/*FN**************************************************************************
 
-                 /* Run a DFA to compute the word size */
-    for(int i=0; i<word.length(); i++)
-    {
-        QChar c = word.at(i);
+       CompStopW( ctx, stopWords )
 
-        switch ( state )
-        {
-            case 0: state = (IsLatVowel(c)) ? 1 : 2;
-                   break;
-            case 1: state = (IsLatVowel(c)) ? 1 : 2;
-                   if ( 2 == state ) result++;
-                   break;
-            case 2: state = (IsLatVowel(c) || ('y' == c)) ? 1 : 2;
-                   break;
-        }
-    }
+   Returns: int -- TRUE (1) if the word was a stop word, FALSE (0) otherwise
 
+   Purpose: Stop words are not stemmed, they are dropped by emptying
+            the word.
 
-    return( result );
+   Plan:    One lookup in the hash set merged from all the step0 tables.
+            endIndex is left alone, as it always was.
+**/
 
-} /* WordSize */
+static int CompStopW( PorterContext &ctx, const WordSet &stopWords )
+{
+    if ( stopWords.contains( ctx.word, ctx.length ) )
+    {
+#ifdef STEMMER_RULE_STATS
+        CountStopWord( ctx, true );
+#endif
+        ctx.length = 0;
+        return( true );
+    }
 
+#ifdef STEMMER_RULE_STATS
+    CountStopWord( ctx, false );
+#endif
+    return( false );
+} /* CompStopW */
 
 
+#ifdef STEMMER_RULE_STATS
+/*FN**************************************************************************
 
+       CompileRuleStats()
 
+   Returns: RuleStats * -- counters for every rule of every step table
 
+   Notes:   The step0 tables are registered one by one, their ids repeat
+            from table to table so rules are told apart by table.
+**/
 
-/*FN**************************************************************************
+static RuleStats *CompileRuleStats()
+{
+    static const char *const step0_names[] =
+           {
+             "step0a", "step0b", "step0c", "step0d", "step0e", "step0f",
+             "step0g", "step0h", "step0i", "step0j", "step0k", "step0l",
+             "step0m", "step0n",
+           };
+    static const struct { const char *name; const PorterRule *rules; } tables[] =
+           {
+             {"step1a", step1a_rules}, {"step1a1", step1a1_rules},
+             {"step1a2", step1a2_rules}, {"step1a3", step1a3_rules},
+             {"step1a4", step1a4_rules}, {"step1a5", step1a5_rules},
+             {"step1a6", step1a6_rules}, {"step1b1", step1b1_rules},
+             {"step2", step2_rules}, {"step3", step3_rules},
+             {"step4", step4_rules}, {"step6", step6_rules},
+           };
+    RuleStats *stats = new RuleStats;
+
+    for(int t=0; NULL != step0_rules[t]; t++)
+    {
+        stats->addStep( step0_names[t], step0_rules[t], sizeof(PorterRule) );
+        for(const PorterRule *rule = step0_rules[t]; 0 != rule->id; rule++)
+            stats->addRule( rule->id, QString( RuleChars( rule->old_end ), rule->old_end.length ) );
+    }
+    for(uint t=0; t<sizeof(tables) / sizeof(tables[0]); t++)
+    {
+        stats->addStep( tables[t].name, tables[t].rules, sizeof(PorterRule) );
+        for(const PorterRule *rule = tables[t].rules; 0 != rule->id; rule++)
+            stats->addRule( rule->id, QString( RuleChars( rule->old_end ), rule->old_end.length ) );
+    }
+
+    return( stats );
+} /* CompileRuleStats */
 
-       ReplaceEnd( word, rule )
 
-   Returns: int -- the id for the rule fired, 0 is none is fired
+/*FN**************************************************************************
 
-   Purpose: Apply a set of rules to replace the suffix of a word
+       CountStopWord( ctx, stopWord )
 
-   Plan:    Loop through the rule set until a match meeting all conditions
-            is found.  If a rule fires, return its id, otherwise return 0.
-            Connditions on the length of the root are checked as part of this
-            function's processing because this check is so often made.
+   Returns: void
 
-   Notes:   This is the main routine driving the stemmer.  It goes through
-            a set of suffix replacement rules looking for a match on the
-            current suffix.  When it finds one, if the root of the word
-            is long enough, and it meets whatever other conditions are
-            required, then the suffix is replaced, and the function returns.
+   Purpose: Count CompStopW() as the step0 tables it replaces: every
+            table is scanned once per word, and a stop word is credited
+            to its first rule in table order, the one that used to fire.
 **/
 
-static int ReplaceEnd( QString &word, RuleList *rule )
+static void CountStopWord( PorterContext &ctx, bool stopWord )
 {
+    bool found = !stopWord;
 
-    int ending;   /* set to start of possible stemmed suffix */
-    QChar tmp_ch;             /* save replaced character when testing */
-
-    while ( 0 != rule->id )
+    for(const PorterRule *const *table = step0_rules; NULL != *table; table++)
     {
-//        qDebug() << "rule ID" << rule->id;
-        ending = endIndex - rule->old_offset;
-        if ( ending >= 0 )
+        rule_stats->called( *table );
+        for(const PorterRule *rule = *table; !found && 0 != rule->id; rule++)
         {
-//            qDebug() << word.right(word.length() - ending) << rule->old_end;
-            if ( word.right(word.length() - ending) == rule->old_end )
+            if(ctx.length == rule->old_end.length
+                    && 0 == memcmp( ctx.word, rule->old_end.text, ctx.length * sizeof(QChar) ))
             {
-//                tmp_ch = word.at(ending);
-//                *ending = EOS;
-
-                if ( rule->min_root_size < WordSize(word) )
-                    if ( !rule->condition || (*rule->condition)(word) )
-                    {
-                        word = word.left( word.length()-rule->old_end.length() );
-                        word.append( rule->new_end );
-//                        (void)strcat( word, rule->new_end );
-                        endIndex = word.length() - 1;
-                        break;
-                    }
-
-//                *ending = tmp_ch;
+                rule_stats->count( rule, RuleStats::Matched );
+                rule_stats->count( rule, RuleStats::Fired );
+                found = true;
             }
         }
-
-        rule++;
     }
+} /* CountStopWord */
+#endif
 
-    return( rule->id );
 
-} /* ReplaceEnd */
+/*FN**************************************************************************
+
+       LVLanguage::isVowel( c )
+
+   Returns: bool -- TRUE if c is a vowel for the WordSize DFA
+**/
 
-static int CompStopW( QString &word, RuleList* rule)
+inline bool LVLanguage::isVowel(QChar c)
 {
-    while ( 0 != rule->id )
-    {
-        if(word == rule->old_end)
-        {
-            word = "";
-            break;
-        }
-        rule++;
-    }
+    return( IsVowel(c) );
+} /* LVLanguage::isVowel */
 
-    return rule->id;
-} /* CompStopW */
 
+/*FN**************************************************************************
+
+       LVLanguage::runSteps( ctx, steps )
 
-static int ReplaceW( QString &word, RuleList* rule)
-{
-    while ( 0 != rule->id )
-    {
-        if(word == rule->old_end)
-        {
-            word = rule->new_end;
-            break;
-        }
-        rule++;
-    }
+   Returns: int -- the length of the stem, 0 for a stop word
 
-    return rule->id;
-} /* ReplaceW */
+   Purpose: Run the Porter algorithm over the measured word in ctx.
 
+   Notes:   Only the first steps entries of step_names are run, for the
+            per step benchmark.  stem() always passes STEP_COUNT.
+**/
 
+int LVLanguage::runSteps(PorterContext &ctx, int steps)
+{
+    const LVTables &tables = Tables();
+
+                /*  Part 2: Run through the Porter algorithm */
+    if ( steps < 1 ) return ctx.length;
+    (void)CompStopW( ctx, tables.stopWords );
+
+    if ( steps < 2 ) return ctx.length;
+    (void)LVEngine::replaceEnd( ctx, step1a_rules, tables.step1a );
+    if ( steps < 3 ) return ctx.length;
+    (void)LVEngine::replaceEnd( ctx, step1a1_rules, tables.step1a1 );
+    if ( steps < 4 ) return ctx.length;
+    (void)LVEngine::replaceEnd( ctx, step1a2_rules, tables.step1a2 );
+    if ( steps < 5 ) return ctx.length;
+    (void)LVEngine::replaceEnd( ctx, step1a3_rules, tables.step1a3 );
+    if ( steps < 6 ) return ctx.length;
+    (void)LVEngine::replaceEnd( ctx, step1a4_rules, tables.step1a4 );
+    if ( steps < 7 ) return ctx.length;
+    (void)LVEngine::replaceEnd( ctx, step1a5_rules, tables.step1a5 );
+    if ( steps < 8 ) return ctx.length;
+    (void)LVEngine::replaceEnd( ctx, step1a6_rules, tables.step1a6 );
+
+    if ( steps < 9 ) return ctx.length;
+    (void)LVEngine::replaceEnd( ctx, step1b1_rules, tables.step1b1 );
+    if ( steps < 10 ) return ctx.length;
+    (void)LVEngine::replaceEnd( ctx, step2_rules, tables.step2 );
+    if ( steps < 11 ) return ctx.length;
+    (void)LVEngine::replaceEnd( ctx, step3_rules, tables.step3 );
+
+    if ( steps < 12 ) return ctx.length;
+    (void)LVEngine::replaceEnd( ctx, step4_rules, tables.step4 );
+
+    if ( steps < 13 ) return ctx.length;
+    (void)LVEngine::replaceWord( ctx, step6_rules );
+
+
+    return ctx.length;
+} /* LVLanguage::runSteps */
+
+#ifdef STEMMER_RULE_STATS
+RuleStats *LVLanguage::ruleStats()
+{
+    return rule_stats;
+}
+#endif
 
 LVPorterStemmer::LVPorterStemmer()
 {
@@ -1328,53 +1454,70 @@ LVPorterStemmer::LVPorterStemmer()
 
 QString LVPorterStemmer::stem(QString word)
 {
-    //int rule;    /* which rule is fired in replacing an end */
-
+    QString lowered = word;
+    int flags;
 
     /* Part 1: Check to ensure the word is all alphabetic */
-    word = word.toLower();
-    for(int i=0; i<word.length(); i++)
+    flags = LowerWord( lowered.data(), lowered.length() );
+    if(flags & LOWER_OUT_OF_RANGE)
     {
-        if(!word.at(i).isLetter())
-            return word;
+        /* Redo it with the full Unicode case mapping */
+        lowered = word.toLower();
+        for(int i=0; i<lowered.length(); i++)
+        {
+            if(!lowered.at(i).isLetter())
+                return lowered;
+        }
     }
+    else if(!(flags & LOWER_ALPHABETIC))
+        return lowered;
 
-    endIndex = word.length()-1;
+    lowered.truncate( LVEngine::stemInPlace( lowered.data(), lowered.length(), STEP_COUNT ) );
 
-//    qDebug() << word << endIndex << ContainsVowel(word) << WordSize(word);
+    return lowered;
+}
 
-                /*  Part 2: Run through the Porter algorithm */
-    (void)CompStopW( word, step0a_rules);
-    (void)CompStopW( word, step0b_rules);
-    (void)CompStopW( word, step0c_rules);
-    (void)CompStopW( word, step0d_rules);
-    (void)CompStopW( word, step0e_rules);
-    (void)CompStopW( word, step0f_rules);
-    (void)CompStopW( word, step0g_rules);
-    (void)CompStopW( word, step0h_rules);
-    (void)CompStopW( word, step0i_rules);
-    (void)CompStopW( word, step0j_rules);
-    (void)CompStopW( word, step0k_rules);
-    (void)CompStopW( word, step0l_rules);
-    (void)CompStopW( word, step0m_rules);
-    (void)CompStopW( word, step0n_rules);
-
-    (void)ReplaceEnd( word, step1a_rules );
-    (void)ReplaceEnd( word, step1a1_rules);
-    (void)ReplaceEnd( word, step1a2_rules);
-    (void)ReplaceEnd( word, step1a3_rules);
-    (void)ReplaceEnd( word, step1a4_rules);
-    (void)ReplaceEnd( word, step1a5_rules);
-    (void)ReplaceEnd( word, step1a6_rules);
-
-    (void)ReplaceEnd( word, step1b1_rules);
-    (void)ReplaceEnd( word, step2_rules);
-    (void)ReplaceEnd( word, step3_rules);
-
-    (void)ReplaceEnd( word, step4_rules);
-
-    (void)ReplaceW( word, step6_rules );
-
-
-    return word;
+int LVPorterStemmer::stem(QChar *word, int length)
+{
+    return stemSteps( word, length, STEP_COUNT );
+}
+
+int LVPorterStemmer::stemSteps(QChar *word, int length, int steps)
+{
+    /* Part 1: Check to ensure the word is all alphabetic */
+    if(!(LowerWord( word, length ) & LOWER_ALPHABETIC))
+        return length;
+
+    return LVEngine::stemInPlace( word, length, steps );
+}
+
+int LVPorterStemmer::stepCount()
+{
+    return STEP_COUNT;
+}
+
+const char *LVPorterStemmer::stepName(int step)
+{
+    return (0 <= step && step < STEP_COUNT) ? step_names[step] : NULL;
+}
+
+QVector<RuleCount> LVPorterStemmer::ruleStats()
+{
+#ifdef STEMMER_RULE_STATS
+    return rule_stats->counts();
+#else
+    return QVector<RuleCount>();
+#endif
+}
+
+void LVPorterStemmer::resetRuleStats()
+{
+#ifdef STEMMER_RULE_STATS
+    rule_stats->reset();
+#endif
+}
+
+QStringList LVPorterStemmer::stemBatch(const QStringList &words)
+{
+    return StemBatch<LVPorterStemmer::stem>( words );
 }
@@ -18,6 +18,9 @@
 #define LVPORTERSTEMMER_H
 
 #include <QString>
+#include <QStringList>
+#include <QVector>
+#include "rulestats.h"
 //#include <QDebug>
 
 class LVPorterStemmer
@@ -25,6 +28,24 @@ class LVPorterStemmer
 public:
     LVPorterStemmer();
     static QString stem(QString word);
+
+    // Stems word[0..length) in place without allocating and returns the
+    // length of the stem. Lowering uses the simple per-character mapping.
+    static int stem(QChar *word, int length);
+
+    static QStringList stemBatch(const QStringList &words);
+
+    // Benchmark hooks: stemSteps() lowers the word like stem() but then
+    // runs only the first steps of the stepCount() steps, in the order
+    // named by stepName().
+    static int stemSteps(QChar *word, int length, int steps);
+    static int stepCount();
+    static const char *stepName(int step);
+
+    // Counters of every rule since start or resetRuleStats(), in table
+    // order. Empty unless built with CONFIG+=stemmer_rule_stats.
+    static QVector<RuleCount> ruleStats();
+    static void resetRuleStats();
 };
 
 #endif // LVPORTERSTEMMER_H
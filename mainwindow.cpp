@@ -7,13 +7,38 @@ Copyright (c) 2014 Raivis Strogonovs
 #include "mainwindow.h"
 #include "ui_mainwindow.h"
 
+#ifdef PROFILE_ALLOCATIONS
+#  include "bench/allocationcount.h"
+#endif
+
+#include <QFile>
+#include <QFileDialog>
+#include <QFileInfo>
+#include <QHeaderView>
+#include <QMessageBox>
+#include <QRegExp>
+
 MainWindow::MainWindow(QWidget *parent) :
     QMainWindow(parent),
-    ui(new Ui::MainWindow)
+    ui(new Ui::MainWindow),
+    fileStemmer(new FileStemmer(this)),
+    profiler(new StemProfiler(this))
 {
     ui->setupUi(this);
 
+    ui->fileResultView->setModel(fileStemmer);
+    ui->fileResultView->horizontalHeader()->setSectionResizeMode(QHeaderView::Stretch);
+    ui->profileStepTable->horizontalHeader()->setSectionResizeMode(QHeaderView::Stretch);
+
     connect(ui->stemBtn, SIGNAL(clicked(bool)), this, SLOT(stemWord()));
+    connect(ui->stemFileBtn, SIGNAL(clicked(bool)), this, SLOT(stemFile()));
+    connect(ui->cancelFileBtn, SIGNAL(clicked(bool)), fileStemmer, SLOT(cancel()));
+    connect(fileStemmer, SIGNAL(progressChanged(int,int)), this, SLOT(showFileProgress(int,int)));
+    connect(fileStemmer, SIGNAL(finished(bool)), this, SLOT(fileStemmed(bool)));
+    connect(ui->profileBtn, SIGNAL(clicked(bool)), this, SLOT(profileWordList()));
+    connect(ui->stopProfileBtn, SIGNAL(clicked(bool)), profiler, SLOT(stop()));
+    connect(profiler, SIGNAL(updated()), this, SLOT(showProfile()));
+    connect(profiler, SIGNAL(finished()), this, SLOT(profileFinished()));
 
 }
 
@@ -36,6 +61,126 @@ void MainWindow::stemWord()
     ui->wordEdit->clear();
 }
 
+TextAnalyzer::StemFunction MainWindow::stemFunction() const
+{
+    if(LANG_EN == ui->langComboBox->currentIndex())
+        return static_cast<TextAnalyzer::StemFunction>(ENPorterStemmer::stem);
+
+    return static_cast<TextAnalyzer::StemFunction>(LVPorterStemmer::stem);
+}
+
+// Stemming runs on the thread pool, the table fills in as chunks finish
+void MainWindow::stemFile()
+{
+    QString fileName = QFileDialog::getOpenFileName(this, tr("Stem file"));
+    if(fileName.isEmpty())
+        return;
+
+    QString error;
+    if(!fileStemmer->start(fileName, stemFunction(), &error))
+    {
+        QMessageBox::warning(this, tr("Stem file"), error);
+        return;
+    }
+
+    ui->stemFileBtn->setEnabled(false);
+    ui->cancelFileBtn->setEnabled(true);
+    ui->fileStatusLbl->setText(tr("Stemming %1...").arg(QFileInfo(fileName).fileName()));
+}
+
+void MainWindow::showFileProgress(int chunksDone, int chunkCount)
+{
+    ui->fileProgressBar->setRange(0, qMax(chunkCount, 1));
+    ui->fileProgressBar->setValue(chunksDone);
+}
+
+void MainWindow::fileStemmed(bool canceled)
+{
+    ui->stemFileBtn->setEnabled(true);
+    ui->cancelFileBtn->setEnabled(false);
+    if(!canceled)
+        ui->fileProgressBar->setValue(ui->fileProgressBar->maximum());
+
+    ui->fileStatusLbl->setText(tr("%1%2 words, %3 distinct, %4 ms")
+                               .arg(canceled ? tr("Canceled: ") : QString())
+                               .arg(fileStemmer->tokenCount())
+                               .arg(fileStemmer->rowCount())
+                               .arg(fileStemmer->elapsed()));
+}
+
+// Replays the words of a file, split at whitespace, through the selected
+// stemmer; the figures refresh while the passes run
+void MainWindow::profileWordList()
+{
+    QString fileName = QFileDialog::getOpenFileName(this, tr("Profile word list"));
+    if(fileName.isEmpty())
+        return;
+
+    QFile file(fileName);
+    if(!file.open(QIODevice::ReadOnly))
+    {
+        QMessageBox::warning(this, tr("Profile word list"), fileName + ": " + file.errorString());
+        return;
+    }
+
+    QVector<QString> words = QString::fromUtf8(file.readAll())
+                             .split(QRegExp("\\s+"), QString::SkipEmptyParts).toVector();
+    QString language = LANG_EN == ui->langComboBox->currentIndex() ? "en" : "lv";
+    if(!profiler->start(language, words, ui->profilePassesSpin->value()))
+    {
+        QMessageBox::warning(this, tr("Profile word list"), tr("%1 has no words").arg(fileName));
+        return;
+    }
+
+    QStringList steps = profiler->stepNames();
+    ui->profileStepTable->setRowCount(steps.size());
+    for(int i=0; i<steps.size(); i++)
+    {
+        ui->profileStepTable->setItem(i, 0, new QTableWidgetItem(steps.at(i)));
+        ui->profileStepTable->setItem(i, 1, new QTableWidgetItem());
+    }
+
+    ui->profileBtn->setEnabled(false);
+    ui->stopProfileBtn->setEnabled(true);
+    showProfile();
+}
+
+void MainWindow::showProfile()
+{
+    ProfileSnapshot figures = profiler->snapshot();
+
+    ui->profilePassesLbl->setText(QString::number(figures.passes));
+    if(figures.words > 0 && figures.nsecs > 0)
+    {
+        ui->wordsPerSecLbl->setText(QString::number(figures.words * 1e9 / figures.nsecs, 'f', 0));
+        ui->latencyLbl->setText(tr("%1 / %2").arg(figures.p50).arg(figures.p99));
+#ifdef PROFILE_ALLOCATIONS
+        QString allocations = QString::number(double(figures.allocations) / figures.words, 'f', 2);
+        if(!AllocationCountComplete())
+            allocations = tr("%1 (operator new only)").arg(allocations);
+        ui->allocationsLbl->setText(allocations);
+#else
+        ui->allocationsLbl->setText(tr("not counted"));
+#endif
+    }
+    else
+    {
+        ui->wordsPerSecLbl->clear();
+        ui->latencyLbl->clear();
+        ui->allocationsLbl->clear();
+    }
+
+    for(int i=0; i<figures.stepNs.size() && i<ui->profileStepTable->rowCount(); i++)
+        ui->profileStepTable->item(i, 1)->setText(QString::number(figures.stepNs.at(i), 'f', 1));
+}
+
+void MainWindow::profileFinished()
+{
+    ui->profileBtn->setEnabled(true);
+    ui->stopProfileBtn->setEnabled(false);
+    showProfile();
+}
+
 void MainWindow::keyReleaseEvent(QKeyEvent *e)
 {
     if(e->key() == Qt::Key_Enter || e->key() == Qt::Key_Return)
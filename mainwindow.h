@@ -5,7 +5,9 @@
 #include <QKeyEvent>
 
 #include "enporterstemmer.h"
+#include "filestemmer.h"
 #include "lvporterstemmer.h"
+#include "stemprofiler.h"
 
 namespace Ui {
 class MainWindow;
@@ -26,9 +28,19 @@ protected:
 
 private slots:
     void stemWord();
+    void stemFile();
+    void showFileProgress(int chunksDone, int chunkCount);
+    void fileStemmed(bool canceled);
+    void profileWordList();
+    void showProfile();
+    void profileFinished();
 
 private:
+    TextAnalyzer::StemFunction stemFunction() const;
+
     Ui::MainWindow *ui;
+    FileStemmer *fileStemmer;
+    StemProfiler *profiler;
 };
 
 #endif // MAINWINDOW_H
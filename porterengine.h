@@ -0,0 +1,446 @@
+/******************************************************************
+
+   Porter stemming engine shared by the languages.
+
+   Original authors: B. Frakes and C. Cox, 1986.
+
+   Rewriten for Qt by: Raivis Strogonovs (http://morf.lv), 2016
+
+   Licensed under GPLv3. See LICENCE.md file
+
+   PorterEngine<Language> is the measure, suffix rule and whole word
+   machinery of ENPorterStemmer and LVPorterStemmer.  A language is a
+   traits type with only static members:
+
+       static bool isVowel(QChar c);
+       static int condition(int condition, PorterContext &ctx);
+       static int runSteps(PorterContext &ctx, int steps);
+
+   isVowel() drives the WordSize DFA.  condition() tests the condition
+   a rule names, a switch over the language's own condition numbers,
+   NO_CONDITION never reaches it.  runSteps() is the step sequence: it
+   calls replaceEnd() and friends with the language's tables and
+   returns ctx.length.  Built with STEMMER_RULE_STATS the language also
+   has static RuleStats *ruleStats().
+
+   Everything is a template over the language, so each one compiles to
+   its own pipeline with the conditions inlined, no calls through
+   function pointers.
+
+**/
+
+#ifndef PORTERENGINE_H
+#define PORTERENGINE_H
+
+#include <QString>
+#include <QVarLengthArray>
+
+#include <string.h>
+
+#include "rulestats.h"
+#include "ruletext.h"
+#include "suffixtrie.h"
+#include "wordset.h"
+
+/* Condition of the rules that have none, languages number theirs from 1 */
+#define NO_CONDITION  0
+
+typedef struct {
+           uchar state;            /* WordSize DFA state after a prefix */
+           int size;               /* WordSize of that prefix */
+           } PorterMeasure;
+
+typedef struct {
+           QChar *word;            /* word being stemmed, edited in place */
+           int length;             /* current length of word */
+           int endIndex;           /* index of the end of the current suffix */
+           PorterMeasure *measure; /* measure[i] is the DFA after word[0..i) */
+           } PorterContext;
+
+typedef struct {
+           int id;                 /* returned if rule fired */
+           RuleText old_end;       /* suffix replaced */
+           RuleText new_end;       /* suffix replacement */
+           int old_offset;         /* from end of word to start of suffix */
+           int new_offset;         /* from beginning to end of new suffix */
+           int min_root_size;      /* min root word size for replacement */
+           int condition;          /* Language::condition() test, or NO_CONDITION */
+           } PorterRule;
+
+template <class Language>
+class PorterEngine
+{
+public:
+    static int stemInPlace(QChar *word, int length, int steps);
+
+    static void measureWord(PorterContext &ctx, int from);
+    static int wordSize(const PorterContext &ctx);
+
+    static int replaceEnd(PorterContext &ctx, const PorterRule *rules, const SuffixTrie &trie);
+    static int replaceEndLinear(PorterContext &ctx, const PorterRule *rule);
+    static int replaceWord(PorterContext &ctx, const PorterRule *rule);
+
+    static SuffixTrie compileRules(const PorterRule *rule);
+    static WordSet compileWords(const PorterRule *const *tables);
+
+private:
+    static int suffixMatches(const PorterContext &ctx, int ending, const RuleText &suffix);
+    static void replaceSuffix(PorterContext &ctx, const PorterRule *rule);
+};
+
+
+/*FN**************************************************************************
+
+       stemInPlace( word, length, steps )
+
+   Returns: int -- the length of the stem
+
+   Purpose: Run the language's steps over an already lowered, all
+            alphabetic word, writing the stem over the word.
+
+   Notes:   Only the first steps steps are run, so the benchmark can time
+            each step as the difference between two prefixes.
+**/
+
+template <class Language>
+int PorterEngine<Language>::stemInPlace(QChar *word, int length, int steps)
+{
+    QVarLengthArray<PorterMeasure, 64> measure( length + 1 );
+    measure[0].state = 0;
+    measure[0].size = 0;
+
+    PorterContext ctx;   /* per-call state, keeps stem() reentrant */
+    ctx.word = word;
+    ctx.length = length;
+    ctx.endIndex = length-1;
+    ctx.measure = measure.data();
+    measureWord( ctx, 0 );
+
+    return( Language::runSteps( ctx, steps ) );
+} /* stemInPlace */
+
+
+/*FN***************************************************************************
+
+       measureWord( ctx, from )
+
+   Returns: void -- fills ctx.measure[from+1..length] in
+
+   Purpose: Count syllables in a special way:  count the number
+            vowel-consonant pairs in a word, disregarding initial
+            consonants and final vowels.  The letter "y" counts as a
+            consonant at the beginning of a word and when it has a vowel
+            in front of it; otherwise (when it follows a consonant) it
+            is treated as a vowel.  For example, the WordSize of "cat"
+            is 1, of "any" is 1, of "amount" is 2, of "anything" is 3.
+
+   Plan:    Run a DFA to compute the word size
+
+   Notes:   The easiest and fastest way to compute this funny measure is
+            with a finite state machine.  The initial state 0 checks
+            the first letter.  If it is a vowel, then the machine changes
+            to state 1, which is the "last letter was a vowel" state.
+            If the first letter is a consonant or y, then it changes
+            to state 2, the "last letter was a consonant state".  In
+            state 1, a y is treated as a consonant (since it follows
+            a vowel), but in state 2, y is treated as a vowel (since
+            it follows a consonant.  The result counter is incremented
+            on the transition from state 1 to state 2, since this
+            transition only occurs after a vowel-consonant pair, which
+            is what we are counting.
+
+            The state and count after every prefix are kept, so when a
+            rule replaces a suffix only the new characters are run
+            through the DFA, starting from where the kept root left off.
+            That keeps stemming linear in the length of the word.
+**/
+
+template <class Language>
+void PorterEngine<Language>::measureWord(PorterContext &ctx, int from)
+{
+    int result;   /* WordSize of the word */
+    int state;    /* current state in machine */
+
+    result = ctx.measure[from].size;
+    state = ctx.measure[from].state;
+
+                 /* Run a DFA to compute the word size */
+    for(int i=from; i<ctx.length; i++)
+    {
+        QChar c = ctx.word[i];
+
+        switch ( state )
+        {
+            case 0: state = (Language::isVowel(c)) ? 1 : 2;
+                   break;
+            case 1: state = (Language::isVowel(c)) ? 1 : 2;
+                   if ( 2 == state ) result++;
+                   break;
+            case 2: state = (Language::isVowel(c) || ('y' == c)) ? 1 : 2;
+                   break;
+        }
+
+        ctx.measure[i+1].state = state;
+        ctx.measure[i+1].size = result;
+    }
+
+} /* measureWord */
+
+
+/*FN**************************************************************************
+
+       wordSize( ctx )
+
+   Returns: int -- the WordSize of the whole current word
+
+   Notes:   measureWord() has already run over the word, this is a lookup.
+**/
+
+template <class Language>
+inline int PorterEngine<Language>::wordSize(const PorterContext &ctx)
+{
+    return( ctx.measure[ctx.length].size );
+} /* wordSize */
+
+
+/*FN**************************************************************************
+
+       suffixMatches( ctx, ending, suffix )
+
+   Returns: int -- TRUE (1) if the word from index ending on equals suffix
+
+   Purpose: Suffix test of replaceEndLinear() on the in-place buffer.
+
+   Notes:   Behaves like word.right(length - ending) == suffix did on a
+            QString, including right() returning the whole word when the
+            count is out of range.
+**/
+
+template <class Language>
+inline int PorterEngine<Language>::suffixMatches(const PorterContext &ctx, int ending, const RuleText &suffix)
+{
+    int count = ctx.length - ending;
+
+    if ( count < 0 || count > ctx.length )
+        count = ctx.length;
+
+    return( count == suffix.length
+            && 0 == memcmp( ctx.word + ctx.length - count, suffix.text, count * sizeof(QChar) ) );
+} /* suffixMatches */
+
+
+/*FN**************************************************************************
+
+       replaceSuffix( ctx, rule )
+
+   Purpose: Replace the old_end of the word with the new_end of rule.
+
+   Notes:   A language's rule sequences must never make a word longer
+            than it was on entry to stem(), so the buffer always has
+            room for new_end.
+**/
+
+template <class Language>
+inline void PorterEngine<Language>::replaceSuffix(PorterContext &ctx, const PorterRule *rule)
+{
+    ctx.length -= rule->old_end.length;
+    memcpy( ctx.word + ctx.length, RuleChars( rule->new_end ), rule->new_end.length * sizeof(QChar) );
+    ctx.length += rule->new_end.length;
+    ctx.endIndex = ctx.length - 1;
+    measureWord( ctx, ctx.length - rule->new_end.length );
+} /* replaceSuffix */
+
+
+/*FN**************************************************************************
+
+       replaceEndLinear( ctx, rule )
+
+   Returns: int -- the id for the rule fired, 0 is none is fired
+
+   Purpose: Apply a set of rules to replace the suffix of a word
+
+   Plan:    Loop through the rule set until a match meeting all conditions
+            is found.  If a rule fires, return its id, otherwise return 0.
+            Connditions on the length of the root are checked as part of this
+            function's processing because this check is so often made.
+
+   Notes:   This is the main routine driving the stemmer.  It goes through
+            a set of suffix replacement rules looking for a match on the
+            current suffix.  When it finds one, if the root of the word
+            is long enough, and it meets whatever other conditions are
+            required, then the suffix is replaced, and the function returns.
+            replaceEnd() uses the compiled trie instead and only falls back
+            to this scan when endIndex is not at the end of the word.
+**/
+
+template <class Language>
+int PorterEngine<Language>::replaceEndLinear(PorterContext &ctx, const PorterRule *rule)
+{
+    int ending;   /* set to start of possible stemmed suffix */
+
+    while ( 0 != rule->id )
+    {
+        ending = ctx.endIndex - rule->old_offset;
+        if ( ending >= 0 )
+        {
+            if ( suffixMatches( ctx, ending, rule->old_end ) )
+            {
+                RULE_STATS_COUNT( Language::ruleStats(), rule, Matched );
+                if ( rule->min_root_size < wordSize(ctx) )
+                {
+                    if ( NO_CONDITION == rule->condition || Language::condition( rule->condition, ctx ) )
+                    {
+                        replaceSuffix( ctx, rule );
+                        RULE_STATS_COUNT( Language::ruleStats(), rule, Fired );
+                        break;
+                    }
+                    RULE_STATS_COUNT( Language::ruleStats(), rule, FailedCondition );
+                }
+                else
+                    RULE_STATS_COUNT( Language::ruleStats(), rule, FailedMinRoot );
+            }
+        }
+
+        rule++;
+    }
+
+    return( rule->id );
+
+} /* replaceEndLinear */
+
+
+/*FN**************************************************************************
+
+       replaceEnd( ctx, rules, trie )
+
+   Returns: int -- the id for the rule fired, 0 is none is fired
+
+   Purpose: Apply a set of rules to replace the suffix of a word
+
+   Plan:    Walk the end of the word backwards through the trie compiled
+            from the rule set to get the rules whose suffix matches, in
+            table order, then check root size and conditions exactly like
+            replaceEndLinear() does.
+
+   Notes:   The trie assumes the suffix ends at the last character of the
+            word.  When endIndex points elsewhere (a condition moved it, an
+            emptied stop word leaves it behind) the linear scan is used so
+            the results stay the same.
+**/
+
+template <class Language>
+int PorterEngine<Language>::replaceEnd(PorterContext &ctx, const PorterRule *rules, const SuffixTrie &trie)
+{
+    int candidates[SUFFIX_TRIE_MAX_RULES];
+    int count;
+    const PorterRule *rule;
+
+    RULE_STATS_CALL( Language::ruleStats(), rules );
+    if ( ctx.endIndex != ctx.length - 1 )
+        return( replaceEndLinear( ctx, rules ) );
+
+    count = trie.match( ctx.word, ctx.length, candidates );
+    for(int i=0; i<count; i++)
+    {
+        rule = rules + candidates[i];
+        RULE_STATS_COUNT( Language::ruleStats(), rule, Matched );
+        if ( rule->min_root_size < wordSize(ctx) )
+        {
+            if ( NO_CONDITION == rule->condition || Language::condition( rule->condition, ctx ) )
+            {
+                replaceSuffix( ctx, rule );
+                RULE_STATS_COUNT( Language::ruleStats(), rule, Fired );
+                return( rule->id );
+            }
+            RULE_STATS_COUNT( Language::ruleStats(), rule, FailedCondition );
+            if ( ctx.endIndex != ctx.length - 1 )
+                return( replaceEndLinear( ctx, rule + 1 ) );
+        }
+        else
+            RULE_STATS_COUNT( Language::ruleStats(), rule, FailedMinRoot );
+    }
+
+    return( 0 );
+
+} /* replaceEnd */
+
+
+/*FN**************************************************************************
+
+       replaceWord( ctx, rule )
+
+   Returns: int -- the id for the rule fired, 0 is none is fired
+
+   Purpose: Replace the whole word by the new_end of the first rule whose
+            old_end is the word.
+**/
+
+template <class Language>
+int PorterEngine<Language>::replaceWord(PorterContext &ctx, const PorterRule *rule)
+{
+    RULE_STATS_CALL( Language::ruleStats(), rule );
+    while ( 0 != rule->id )
+    {
+        if(ctx.length == rule->old_end.length
+                && 0 == memcmp( ctx.word, rule->old_end.text, ctx.length * sizeof(QChar) ))
+        {
+            RULE_STATS_COUNT( Language::ruleStats(), rule, Matched );
+            RULE_STATS_COUNT( Language::ruleStats(), rule, Fired );
+            Q_ASSERT( rule->new_end.length <= ctx.length );
+            memcpy( ctx.word, RuleChars( rule->new_end ), rule->new_end.length * sizeof(QChar) );
+            ctx.length = rule->new_end.length;
+            measureWord( ctx, 0 );
+            break;
+        }
+        rule++;
+    }
+
+    return rule->id;
+} /* replaceWord */
+
+
+/*FN**************************************************************************
+
+       compileRules( rule )
+
+   Returns: SuffixTrie -- the rule set keyed on reversed suffixes
+
+   Purpose: Build the lookup structure replaceEnd() uses for a rule set.
+**/
+
+template <class Language>
+SuffixTrie PorterEngine<Language>::compileRules(const PorterRule *rule)
+{
+    SuffixTrie trie;
+
+    for(int i=0; 0 != rule[i].id; i++)
+        trie.addSuffix( RuleChars( rule[i].old_end ), rule[i].old_end.length, i );
+
+    return( trie );
+} /* compileRules */
+
+
+/*FN**************************************************************************
+
+       compileWords( tables )
+
+   Returns: WordSet -- every old_end of the given tables
+
+   Purpose: Build a set of whole words, such as stop words, to look words
+            up in with one probe.  tables is a NULL terminated list of
+            rule tables; the set points into their static text.
+**/
+
+template <class Language>
+WordSet PorterEngine<Language>::compileWords(const PorterRule *const *tables)
+{
+    WordSet words;
+
+    for(; NULL != *tables; tables++)
+        for(const PorterRule *rule=*tables; 0 != rule->id; rule++)
+            words.insert( rule->old_end );
+
+    return( words );
+} /* compileWords */
+
+#endif // PORTERENGINE_H
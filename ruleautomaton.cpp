@@ -0,0 +1,684 @@
+/******************************************************************
+
+   Rule sets compiled from text into a flat binary image, and the
+   Porter engine that runs them straight from a memory mapped file.
+
+   Licensed under GPLv3. See LICENCE.md file
+
+**/
+
+#include "ruleautomaton.h"
+#include "lowercase.h"
+#include "porterengine.h"
+
+#include <QVarLengthArray>
+
+#include <string.h>
+
+/*****************************************************************************/
+/*****************   Private Defines and Data Structures   *******************/
+
+typedef struct {
+           QChar *word;            /* word being stemmed, edited in place */
+           int length;             /* current length of word */
+           int endIndex;           /* index of the end of the current suffix */
+           PorterMeasure *measure; /* measure[i] is the DFA after word[0..i) */
+           const ushort *vowels;   /* the image's pools */
+           int vowelCount;
+           const AutomatonRule *rules;
+           const AutomatonNode *nodes;
+           const qint32 *indices;
+           const ushort *text;
+           } RunContext;
+
+/*****************************************************************************/
+/********************   Private Function Declarations   **********************/
+static bool IsVowel( const RunContext &ctx, QChar ch );
+static void MeasureWord( RunContext &ctx, int from );
+static int WordSize( const RunContext &ctx );
+static int ContainsVowel( RunContext &ctx );
+static int EndsWithCVC( RunContext &ctx );
+static int TestCondition( RunContext &ctx, quint32 condition );
+static int SuffixMatches( const RunContext &ctx, int ending, const AutomatonRule *rule );
+static void ReplaceSuffix( RunContext &ctx, const AutomatonRule *rule );
+static int ReplaceEndLinear( RunContext &ctx, const AutomatonStep &step, int first );
+static int ReplaceEnd( RunContext &ctx, const AutomatonStep &step );
+static int ReplaceWord( RunContext &ctx, const AutomatonStep &step );
+
+
+/*FN**************************************************************************
+
+       IsVowel( ctx, ch )
+
+   Returns: bool -- TRUE if ch is one of the image's vowels
+
+   Plan:    Binary search, the vowels are stored in ascending order.
+**/
+
+static bool IsVowel( const RunContext &ctx, QChar ch )
+{
+    int low = 0;
+    int high = ctx.vowelCount;
+
+    while ( low < high )
+    {
+        int middle = (low + high) / 2;
+        if ( ctx.vowels[middle] < ch.unicode() )
+            low = middle + 1;
+        else
+            high = middle;
+    }
+
+    return( low < ctx.vowelCount && ctx.vowels[low] == ch.unicode() );
+} /* IsVowel */
+
+
+/*FN**************************************************************************
+
+       MeasureWord( ctx, from )
+
+   Returns: void -- fills ctx.measure[from+1..length] in
+
+   Purpose: The WordSize DFA of PorterEngine::measureWord(), over the
+            image's vowels.
+**/
+
+static void MeasureWord( RunContext &ctx, int from )
+{
+    int result = ctx.measure[from].size;
+    int state = ctx.measure[from].state;
+
+    for(int i=from; i<ctx.length; i++)
+    {
+        QChar c = ctx.word[i];
+
+        switch ( state )
+        {
+            case 0: state = (IsVowel(ctx, c)) ? 1 : 2;
+                   break;
+            case 1: state = (IsVowel(ctx, c)) ? 1 : 2;
+                   if ( 2 == state ) result++;
+                   break;
+            case 2: state = (IsVowel(ctx, c) || ('y' == c)) ? 1 : 2;
+                   break;
+        }
+
+        ctx.measure[i+1].state = state;
+        ctx.measure[i+1].size = result;
+    }
+} /* MeasureWord */
+
+static int WordSize( const RunContext &ctx )
+{
+    return( ctx.measure[ctx.length].size );
+} /* WordSize */
+
+
+/*FN**************************************************************************
+
+       ContainsVowel( ctx ), EndsWithCVC( ctx )
+
+   Purpose: The English conditions with the image's vowels in place of
+            "aeiou", see enporterstemmer.cpp.  EndsWithCVC() moves
+            endIndex the same way.
+**/
+
+static int ContainsVowel( RunContext &ctx )
+{
+    if ( 0 == ctx.length )
+        return( false );
+
+    if ( IsVowel( ctx, ctx.word[0] ) )
+        return( true );
+
+    for(int i=1; i<ctx.length; i++)
+    {
+        if ( IsVowel( ctx, ctx.word[i] ) || 'y' == ctx.word[i] )
+            return( true );
+    }
+
+    return( false );
+} /* ContainsVowel */
+
+static int EndsWithCVC( RunContext &ctx )
+{
+    if ( ctx.length < 2 )
+        return( false );
+
+    ctx.endIndex = ctx.length-1;
+    QChar last = ctx.word[ctx.endIndex--];
+    if ( !IsVowel( ctx, last ) && last != 'w' && last != 'x' && last != 'y' )
+        return( false );
+
+    QChar middle = ctx.word[ctx.endIndex--];
+    if ( !IsVowel( ctx, middle ) && middle != 'y' )
+        return( false );
+
+    return( 0 <= ctx.endIndex && IsVowel( ctx, ctx.word[ctx.endIndex] ) );
+} /* EndsWithCVC */
+
+
+/*FN**************************************************************************
+
+       TestCondition( ctx, condition )
+
+   Returns: int -- TRUE (1) if the word meets the named condition
+**/
+
+static int TestCondition( RunContext &ctx, quint32 condition )
+{
+    switch ( condition )
+    {
+        case RULE_CONDITION_CONTAINS_VOWEL: return( ContainsVowel(ctx) );
+        case RULE_CONDITION_ADD_AN_E:       return( (1 == WordSize(ctx)) && EndsWithCVC(ctx) );
+        case RULE_CONDITION_REMOVE_AN_E:    return( (1 == WordSize(ctx)) && !EndsWithCVC(ctx) );
+    }
+
+    return( true );
+} /* TestCondition */
+
+
+/*FN**************************************************************************
+
+       SuffixMatches( ctx, ending, rule )
+
+   Returns: int -- TRUE (1) if the word from index ending on is old_end
+
+   Notes:   Same out of range behaviour as PorterEngine::suffixMatches().
+**/
+
+static int SuffixMatches( const RunContext &ctx, int ending, const AutomatonRule *rule )
+{
+    int count = ctx.length - ending;
+
+    if ( count < 0 || count > ctx.length )
+        count = ctx.length;
+
+    return( count == int(rule->oldLength)
+            && 0 == memcmp( ctx.word + ctx.length - count, ctx.text + rule->oldText, count * sizeof(QChar) ) );
+} /* SuffixMatches */
+
+static void ReplaceSuffix( RunContext &ctx, const AutomatonRule *rule )
+{
+    ctx.length -= rule->oldLength;
+    memcpy( ctx.word + ctx.length, reinterpret_cast<const QChar *>( ctx.text + rule->newText ), rule->newLength * sizeof(QChar) );
+    ctx.length += rule->newLength;
+    ctx.endIndex = ctx.length - 1;
+    MeasureWord( ctx, ctx.length - rule->newLength );
+} /* ReplaceSuffix */
+
+
+/*FN**************************************************************************
+
+       ReplaceEndLinear( ctx, step, first )
+
+   Returns: int -- the id for the rule fired, 0 is none is fired
+
+   Purpose: Scan the step's rules from rule first on, exactly like
+            PorterEngine::replaceEndLinear().
+**/
+
+static int ReplaceEndLinear( RunContext &ctx, const AutomatonStep &step, int first )
+{
+    for(quint32 i=first; i<step.ruleCount; i++)
+    {
+        const AutomatonRule *rule = ctx.rules + step.firstRule + i;
+        int ending = ctx.endIndex - rule->oldOffset;
+
+        if ( ending >= 0 && SuffixMatches( ctx, ending, rule )
+             && rule->minRootSize < WordSize(ctx)
+             && TestCondition( ctx, rule->condition ) )
+        {
+            ReplaceSuffix( ctx, rule );
+            return( rule->id );
+        }
+    }
+
+    return( 0 );
+} /* ReplaceEndLinear */
+
+
+/*FN**************************************************************************
+
+       ReplaceEnd( ctx, step )
+
+   Returns: int -- the id for the rule fired, 0 is none is fired
+
+   Plan:    Walk the end of the word backwards through the step's trie,
+            collecting the rules of every node passed, then try them in
+            table order like PorterEngine::replaceEnd().  Children are
+            found by binary search on their character.
+**/
+
+static int ReplaceEnd( RunContext &ctx, const AutomatonStep &step )
+{
+    QVarLengthArray<int, 64> candidates;
+    const AutomatonNode *node = ctx.nodes + step.root;
+    int i = ctx.length;
+
+    if ( ctx.endIndex != ctx.length - 1 )
+        return( ReplaceEndLinear( ctx, step, 0 ) );
+
+    for(;;)
+    {
+        for(quint32 r=0; r<node->ruleCount; r++)
+            candidates.append( ctx.indices[node->rules + r] );
+
+        if ( 0 == i )
+            break;
+
+        ushort ch = ctx.word[--i].unicode();
+        int low = 0;
+        int high = node->childCount;
+        const AutomatonNode *children = ctx.nodes + node->firstChild;
+        while ( low < high )
+        {
+            int middle = (low + high) / 2;
+            if ( children[middle].ch < ch )
+                low = middle + 1;
+            else
+                high = middle;
+        }
+
+        if ( low == node->childCount || children[low].ch != ch )
+            break;
+        node = children + low;
+    }
+
+                /* Insertion sort, there are only ever a handful of matches */
+    for(int j=1; j<candidates.size(); j++)
+    {
+        int rule = candidates[j];
+        int k = j;
+        while ( k > 0 && candidates[k-1] > rule )
+        {
+            candidates[k] = candidates[k-1];
+            k--;
+        }
+        candidates[k] = rule;
+    }
+
+    for(int j=0; j<candidates.size(); j++)
+    {
+        const AutomatonRule *rule = ctx.rules + step.firstRule + candidates[j];
+        if ( int(rule->oldLength) > ctx.length )
+            continue;      /* only a damaged trie lists such a rule */
+        if ( rule->minRootSize < WordSize(ctx) )
+        {
+            if ( TestCondition( ctx, rule->condition ) )
+            {
+                ReplaceSuffix( ctx, rule );
+                return( rule->id );
+            }
+            if ( ctx.endIndex != ctx.length - 1 )
+                return( ReplaceEndLinear( ctx, step, candidates[j] + 1 ) );
+        }
+    }
+
+    return( 0 );
+} /* ReplaceEnd */
+
+
+/*FN**************************************************************************
+
+       ReplaceWord( ctx, step )
+
+   Returns: int -- the id for the rule fired, 0 is none is fired
+
+   Purpose: Replace the whole word when it is the old_end of a rule, like
+            PorterEngine::replaceWord().  The hash slots hold the first
+            rule of each word, so one probe sequence finds it.
+**/
+
+static int ReplaceWord( RunContext &ctx, const AutomatonStep &step )
+{
+    quint32 mask = step.slotCount - 1;
+    quint32 i = RuleAutomaton::hash( ctx.word, ctx.length ) & mask;
+
+    for(;;)
+    {
+        qint32 slot = ctx.indices[step.slots + i];
+        if ( slot < 0 )
+            return( 0 );
+
+        const AutomatonRule *rule = ctx.rules + step.firstRule + slot;
+        if ( ctx.length == int(rule->oldLength)
+             && 0 == memcmp( ctx.word, ctx.text + rule->oldText, ctx.length * sizeof(QChar) ) )
+        {
+            memcpy( ctx.word, reinterpret_cast<const QChar *>( ctx.text + rule->newText ), rule->newLength * sizeof(QChar) );
+            ctx.length = rule->newLength;
+            MeasureWord( ctx, 0 );
+            return( rule->id );
+        }
+
+        i = (i + 1) & mask;
+    }
+} /* ReplaceWord */
+
+
+RuleAutomaton::RuleAutomaton()
+    : header( NULL ), growth( 0 )
+{
+}
+
+/*FN**************************************************************************
+
+       load( fileName )
+
+   Returns: bool -- false if the file cannot be mapped or is no valid image
+
+   Purpose: Map a compiled rule set.  The pages stay mapped for the life
+            of the automaton and are shared with every other process
+            mapping the same file.
+**/
+
+bool RuleAutomaton::load(const QString &fileName)
+{
+    header = NULL;
+    if(!mapped.map( fileName, &error ))
+        return false;
+
+    if(!attach( mapped.data(), mapped.size() ))
+        return fail( fileName + ": " + error );
+
+    return true;
+} /* load */
+
+bool RuleAutomaton::setImage(const QByteArray &image)
+{
+    header = NULL;
+    mapped.setImage( image );
+
+    return attach( mapped.data(), mapped.size() );
+}
+
+bool RuleAutomaton::fail(const QString &message)
+{
+    header = NULL;
+    error = message;
+    return false;
+}
+
+
+/*FN**************************************************************************
+
+       attach( image, size )
+
+   Returns: bool -- false if the image is not a valid compiled rule set
+
+   Purpose: Check every offset, count and index of the image once, so the
+            stemming loops can trust them and a damaged or hostile file
+            cannot make them read outside the image.
+
+   Notes:   Trie children must come after their parent inside the step's
+            node range, which also rules out cycles.
+**/
+
+bool RuleAutomaton::attach(const uchar *image, qint64 size)
+{
+    const AutomatonHeader *head = reinterpret_cast<const AutomatonHeader *>( image );
+
+    if(!CheckImageHeader( image, size, sizeof(AutomatonHeader), RULE_AUTOMATON_MAGIC,
+                          RULE_AUTOMATON_VERSION, "rule automaton", &error ))
+        return false;
+
+    ImageSection sections[] =
+           {
+             { head->vowels, head->vowelCount, sizeof(ushort) },
+             { head->steps, head->stepCount, sizeof(AutomatonStep) },
+             { head->rules, head->ruleCount, sizeof(AutomatonRule) },
+             { head->nodes, head->nodeCount, sizeof(AutomatonNode) },
+             { head->indices, head->indexCount, sizeof(qint32) },
+             { head->text, head->textLength, sizeof(ushort) },
+             { head->names, head->namesSize, 1 },
+           };
+    if(!SectionsFit( sections, int(sizeof(sections) / sizeof(sections[0])), size ))
+        return fail( "rule automaton section out of range" );
+
+    vowels = reinterpret_cast<const ushort *>( image + head->vowels );
+    steps = reinterpret_cast<const AutomatonStep *>( image + head->steps );
+    rules = reinterpret_cast<const AutomatonRule *>( image + head->rules );
+    nodes = reinterpret_cast<const AutomatonNode *>( image + head->nodes );
+    indices = reinterpret_cast<const qint32 *>( image + head->indices );
+    text = reinterpret_cast<const ushort *>( image + head->text );
+    names = reinterpret_cast<const char *>( image + head->names );
+
+    for(quint32 i=1; i<head->vowelCount; i++)
+    {
+        if(vowels[i-1] >= vowels[i])
+            return fail( "rule automaton vowels are not sorted" );
+    }
+
+    if(0 == head->namesSize || 0 != names[head->namesSize - 1])
+        return fail( "rule automaton step names are not terminated" );
+
+    for(quint32 i=0; i<head->ruleCount; i++)
+    {
+        const AutomatonRule &rule = rules[i];
+        if(0 == rule.id || rule.condition >= RULE_CONDITION_COUNT
+                || rule.oldOffset != qint32(rule.oldLength) - 1
+                || rule.oldText > head->textLength || rule.oldLength > head->textLength - rule.oldText
+                || rule.newText > head->textLength || rule.newLength > head->textLength - rule.newText)
+            return fail( QString( "rule automaton rule %1 is invalid" ).arg( i ) );
+    }
+
+    growth = 0;
+    for(quint32 s=0; s<head->stepCount; s++)
+    {
+        const AutomatonStep &step = steps[s];
+        QString bad = QString( "rule automaton step %1 is invalid" ).arg( s );
+
+        if(step.name >= head->namesSize || step.firstRule > head->ruleCount
+                || step.ruleCount > head->ruleCount - step.firstRule
+                || step.when > head->indexCount || step.whenCount > head->indexCount - step.when)
+            return fail( bad );
+
+        /* A step fires one rule at most, so the stem can gain at most
+           the largest growth of each step */
+        int most = 0;
+        for(quint32 i=step.firstRule; i<step.firstRule + step.ruleCount; i++)
+            most = qMax( most, int(rules[i].newLength) - int(rules[i].oldLength) );
+        growth += most;
+
+        if(RULE_STEP_SUFFIX == step.kind)
+        {
+            if(step.root >= head->nodeCount || 0 == step.nodeCount
+                    || step.nodeCount > head->nodeCount - step.root)
+                return fail( bad );
+
+            for(quint32 n=step.root; n<step.root + step.nodeCount; n++)
+            {
+                const AutomatonNode &node = nodes[n];
+                if((0 != node.childCount && (node.firstChild <= n
+                        || node.firstChild + node.childCount > step.root + step.nodeCount))
+                        || node.rules > head->indexCount || node.ruleCount > head->indexCount - node.rules)
+                    return fail( bad );
+                for(quint32 r=0; r<node.ruleCount; r++)
+                {
+                    if(indices[node.rules + r] < 0 || quint32(indices[node.rules + r]) >= step.ruleCount)
+                        return fail( bad );
+                }
+            }
+        }
+        else if(RULE_STEP_WORD == step.kind)
+        {
+            bool free = false;
+            if(0 == step.slotCount || 0 != (step.slotCount & (step.slotCount - 1))
+                    || step.slots > head->indexCount || step.slotCount > head->indexCount - step.slots)
+                return fail( bad );
+
+            for(quint32 i=0; i<step.slotCount; i++)
+            {
+                qint32 slot = indices[step.slots + i];
+                if(slot >= 0 && quint32(slot) >= step.ruleCount)
+                    return fail( bad );
+                free = free || slot < 0;
+            }
+            if(!free)
+                return fail( bad );    /* a probe would never end */
+        }
+        else
+            return fail( bad );
+    }
+
+    header = head;
+    error.clear();
+    return true;
+} /* attach */
+
+
+/*FN**************************************************************************
+
+       run( word, length, steps )
+
+   Returns: int -- the length of the stem
+
+   Purpose: Run the first steps steps over an already lowered, all
+            alphabetic word.  word must have room for maxStemLength().
+**/
+
+int RuleAutomaton::run(QChar *word, int length, int steps) const
+{
+    QVarLengthArray<PorterMeasure, 64> measure( maxStemLength( length ) + 1 );
+    measure[0].state = 0;
+    measure[0].size = 0;
+
+    RunContext ctx;   /* per-call state, keeps stem() reentrant */
+    ctx.word = word;
+    ctx.length = length;
+    ctx.endIndex = length-1;
+    ctx.measure = measure.data();
+    ctx.vowels = vowels;
+    ctx.vowelCount = header->vowelCount;
+    ctx.rules = rules;
+    ctx.nodes = nodes;
+    ctx.indices = indices;
+    ctx.text = text;
+    MeasureWord( ctx, 0 );
+
+    int fired = 0;     /* id of the rule the step before fired */
+    for(int s=0; s<steps && s<int(header->stepCount); s++)
+    {
+        const AutomatonStep &step = this->steps[s];
+
+        if(0 != step.whenCount)
+        {
+            bool wanted = false;
+            for(quint32 i=0; i<step.whenCount; i++)
+                wanted = wanted || fired == indices[step.when + i];
+            if(!wanted)
+            {
+                fired = 0;
+                continue;
+            }
+        }
+
+        if(RULE_STEP_SUFFIX == step.kind)
+            fired = ReplaceEnd( ctx, step );
+        else
+            fired = ReplaceWord( ctx, step );
+    }
+
+    return ctx.length;
+} /* run */
+
+
+/*FN**************************************************************************
+
+       stemSteps( word, length, capacity, steps )
+
+   Returns: int -- the length of the stem, which may exceed capacity
+
+   Purpose: Lower word[0..length) and, if it is all letters, run the
+            first steps steps over it.  A word with room for
+            maxStemLength() is stemmed in place, others in a copy.
+**/
+
+int RuleAutomaton::stemSteps(QChar *word, int length, int capacity, int steps) const
+{
+    if(NULL == header)
+        return length;
+
+    /* Part 1: Check to ensure the word is all alphabetic */
+    if(!(LowerWord( word, length ) & LOWER_ALPHABETIC))
+        return length;
+
+    if(capacity >= maxStemLength( length ))
+        return run( word, length, steps );
+
+    QVarLengthArray<QChar, 64> buffer( maxStemLength( length ) );
+    memcpy( buffer.data(), word, length * sizeof(QChar) );
+    length = run( buffer.data(), length, steps );
+    memcpy( word, buffer.constData(), qMin(length, capacity) * sizeof(QChar) );
+
+    return length;
+} /* stemSteps */
+
+int RuleAutomaton::stem(QChar *word, int length, int capacity) const
+{
+    return stemSteps( word, length, capacity, stepCount() );
+}
+
+QString RuleAutomaton::stem(const QString &word) const
+{
+    QString lowered = word;
+    int flags;
+
+    if(NULL == header)
+        return word;
+
+    /* Part 1: Check to ensure the word is all alphabetic */
+    flags = LowerWord( lowered.data(), lowered.length() );
+    if(flags & LOWER_OUT_OF_RANGE)
+    {
+        /* Redo it with the full Unicode case mapping */
+        lowered = word.toLower();
+        for(int i=0; i<lowered.length(); i++)
+        {
+            if(!lowered.at(i).isLetter())
+                return lowered;
+        }
+    }
+    else if(!(flags & LOWER_ALPHABETIC))
+        return lowered;
+
+    int length = lowered.length();
+    lowered.resize( maxStemLength( length ) );
+    lowered.truncate( run( lowered.data(), length, stepCount() ) );
+
+    return lowered;
+}
+
+int RuleAutomaton::stepCount() const
+{
+    return NULL == header ? 0 : int(header->stepCount);
+}
+
+const char *RuleAutomaton::stepName(int step) const
+{
+    return (0 <= step && step < stepCount()) ? names + steps[step].name : NULL;
+}
+
+
+/*FN**************************************************************************
+
+       hash( word, length )
+
+   Returns: quint32 -- FNV-1a over the UTF-16 code units
+
+   Notes:   Part of the image format, RuleCompiler lays the word steps
+            out with it.
+**/
+
+quint32 RuleAutomaton::hash(const QChar *word, int length)
+{
+    quint32 h = 2166136261u;
+
+    for(int i=0; i<length; i++)
+    {
+        h ^= word[i].unicode();
+        h *= 16777619u;
+    }
+
+    return h;
+} /* hash */
@@ -0,0 +1,135 @@
+/******************************************************************
+
+   Rule sets compiled from text into a flat binary image, and the
+   Porter engine that runs them straight from a memory mapped file.
+
+   The image is what RuleCompiler writes: a header, then arrays of
+   fixed size records that refer to each other by index, so it is
+   used in place, needs no pointer fixups and its pages are shared by
+   every process mapping the same file.  Numbers are in host byte
+   order, the header magic tells a foreign image apart.
+
+   Licensed under GPLv3. See LICENCE.md file
+
+**/
+
+#ifndef RULEAUTOMATON_H
+#define RULEAUTOMATON_H
+
+#include <QString>
+
+#include "imageformat.h"
+
+#define RULE_AUTOMATON_MAGIC    0x41525350u  /* "PSRA" read as little endian */
+#define RULE_AUTOMATON_VERSION  1
+
+/* Step kinds */
+#define RULE_STEP_SUFFIX  0         /* replace a suffix, like ReplaceEnd() */
+#define RULE_STEP_WORD    1         /* replace the whole word, like ReplaceW() */
+
+/* Named conditions a rule can have, the English ones */
+#define RULE_CONDITION_NONE            0
+#define RULE_CONDITION_CONTAINS_VOWEL  1
+#define RULE_CONDITION_ADD_AN_E        2
+#define RULE_CONDITION_REMOVE_AN_E     3
+#define RULE_CONDITION_COUNT           4
+
+typedef struct {
+           quint32 magic;          /* RULE_AUTOMATON_MAGIC */
+           quint32 version;        /* RULE_AUTOMATON_VERSION */
+           quint32 size;           /* bytes in the whole image */
+           quint32 vowels;         /* offset of the ascending vowel code units */
+           quint32 vowelCount;
+           quint32 steps;          /* offset of the AutomatonStep array */
+           quint32 stepCount;
+           quint32 rules;          /* offset of the AutomatonRule array */
+           quint32 ruleCount;
+           quint32 nodes;          /* offset of the AutomatonNode array */
+           quint32 nodeCount;
+           quint32 indices;        /* offset of the qint32 pool lists point into */
+           quint32 indexCount;
+           quint32 text;           /* offset of the UTF-16 pool of rule text */
+           quint32 textLength;
+           quint32 names;          /* offset of the NUL terminated step names */
+           quint32 namesSize;
+           } AutomatonHeader;
+
+typedef struct {
+           quint32 name;           /* offset of the name in the names pool */
+           quint32 kind;           /* RULE_STEP_SUFFIX or RULE_STEP_WORD */
+           quint32 firstRule;      /* the step's rules, in table order */
+           quint32 ruleCount;
+           quint32 root;           /* suffix steps: trie root node */
+           quint32 nodeCount;      /* suffix steps: trie nodes from root on */
+           quint32 slots;          /* word steps: hash slots in the index pool */
+           quint32 slotCount;      /* word steps: a power of two */
+           quint32 when;           /* ids the step before must have fired ... */
+           quint32 whenCount;      /* ... for this one to run, 0 for always */
+           } AutomatonStep;
+
+typedef struct {
+           qint32 id;              /* returned if rule fired, never 0 */
+           quint32 oldText;        /* suffix replaced, offset into text */
+           quint32 oldLength;
+           quint32 newText;        /* suffix replacement, offset into text */
+           quint32 newLength;
+           qint32 oldOffset;       /* from end of word to start of suffix */
+           qint32 newOffset;       /* from beginning to end of new suffix */
+           qint32 minRootSize;     /* min root word size for replacement */
+           quint32 condition;      /* RULE_CONDITION_* */
+           } AutomatonRule;
+
+typedef struct {
+           quint16 ch;             /* character on the edge into this node */
+           quint16 childCount;
+           quint32 firstChild;     /* children are adjacent, ascending by ch */
+           quint32 rules;          /* rules ending here, ascending step indices */
+           quint32 ruleCount;
+           } AutomatonNode;
+
+class RuleAutomaton
+{
+public:
+    RuleAutomaton();
+
+    bool load(const QString &fileName);
+    bool setImage(const QByteArray &image);
+    bool isValid() const { return NULL != header; }
+    QString errorString() const { return error; }
+
+    QString stem(const QString &word) const;
+
+    // Stems word[0..length) in place and returns the length of the stem.
+    // A rule set may grow a word; only the first capacity characters are
+    // written, maxStemLength() is always enough.
+    int stem(QChar *word, int length, int capacity) const;
+    int stemSteps(QChar *word, int length, int capacity, int steps) const;
+    int maxStemLength(int length) const { return length + growth; }
+
+    int stepCount() const;
+    const char *stepName(int step) const;
+
+    static quint32 hash(const QChar *word, int length);
+
+private:
+    Q_DISABLE_COPY(RuleAutomaton)
+
+    bool attach(const uchar *data, qint64 size);
+    bool fail(const QString &message);
+    int run(QChar *word, int length, int steps) const;
+
+    MappedImage mapped;             /* of load() or setImage() */
+    QString error;
+
+    const AutomatonHeader *header;  /* NULL until an image is attached */
+    const ushort *vowels;
+    const AutomatonStep *steps;
+    const AutomatonRule *rules;
+    const AutomatonNode *nodes;
+    const qint32 *indices;
+    const ushort *text;
+    const char *names;
+    int growth;                     /* most characters a stem can gain */
+};
+
+#endif // RULEAUTOMATON_H
@@ -0,0 +1,17 @@
+#-------------------------------------------------
+#
+# Compiles text rule sets into rule automaton images
+#
+#-------------------------------------------------
+
+QT       += core
+QT       -= gui
+
+TARGET = QtPorterStemmerRulec
+CONFIG   += console
+CONFIG   -= app_bundle
+TEMPLATE = app
+
+include(../stemmer.pri)
+
+SOURCES += main.cpp
@@ -0,0 +1,74 @@
+/******************************************************************
+
+   Offline rule compiler: turns a text rule set into the binary image
+   RuleAutomaton maps, and checks that the image loads.
+
+   Licensed under GPLv3. See LICENCE.md file
+
+**/
+
+#include <QCoreApplication>
+#include <QCommandLineParser>
+#include <QFile>
+#include <QFileInfo>
+
+#include <stdio.h>
+
+#include "ruleautomaton.h"
+#include "rulecompiler.h"
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication a(argc, argv);
+    QCoreApplication::setApplicationName( "QtPorterStemmerRulec" );
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription( "Compiles a text rule set into a rule automaton image." );
+    parser.addHelpOption();
+    QCommandLineOption outputOption( QStringList() << "o" << "output", "Image to write (default: the input with a .psa suffix).", "file" );
+    parser.addOption( outputOption );
+    parser.addPositionalArgument( "rules", "Text rule set." );
+    parser.process( a );
+
+    if(1 != parser.positionalArguments().size())
+        parser.showHelp( 1 );
+
+    QString name = parser.positionalArguments().at(0);
+    QFile in( name );
+    if(!in.open( QIODevice::ReadOnly ))
+    {
+        fprintf( stderr, "%s: %s\n", qPrintable(name), qPrintable(in.errorString()) );
+        return 1;
+    }
+
+    RuleCompiler compiler;
+    if(!compiler.compile( QString::fromUtf8( in.readAll() ) ))
+    {
+        fprintf( stderr, "%s: %s\n", qPrintable(name), qPrintable(compiler.errorString()) );
+        return 1;
+    }
+
+    RuleAutomaton automaton;
+    if(!automaton.setImage( compiler.image() ))
+    {
+        fprintf( stderr, "%s: %s\n", qPrintable(name), qPrintable(automaton.errorString()) );
+        return 1;
+    }
+
+    QString outName = parser.value( outputOption );
+    if(outName.isEmpty())
+    {
+        QFileInfo info( name );
+        outName = info.path() + "/" + info.completeBaseName() + ".psa";
+    }
+
+    QFile out( outName );
+    QByteArray image = compiler.image();
+    if(!out.open( QIODevice::WriteOnly ) || out.write( image ) != image.size() || !out.flush())
+    {
+        fprintf( stderr, "%s: %s\n", qPrintable(outName), qPrintable(out.errorString()) );
+        return 1;
+    }
+
+    return 0;
+}
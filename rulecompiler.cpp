@@ -0,0 +1,381 @@
+/******************************************************************
+
+   Compiles a text rule set into the binary image RuleAutomaton runs.
+
+   Licensed under GPLv3. See LICENCE.md file
+
+**/
+
+#include "rulecompiler.h"
+#include "ruleautomaton.h"
+#include "imageformat.h"
+
+#include <QMap>
+#include <QStringList>
+
+#include <algorithm>
+#include <string.h>
+
+/*****************************************************************************/
+/*****************   Private Defines and Data Structures   *******************/
+
+/* Condition names of the text format, indexed by RULE_CONDITION_* */
+static const char *const condition_names[RULE_CONDITION_COUNT] =
+           {
+             "", "contains_vowel", "add_an_e", "remove_an_e",
+           };
+
+/* Trie node while building, children keyed by character */
+typedef struct {
+           QMap<ushort, int> children;
+           QVector<int> rules;     /* step indices of the rules ending here */
+           } BuildNode;
+
+/*****************************************************************************/
+/********************   Private Function Declarations   **********************/
+static void AddSuffix( QVector<BuildNode> &trie, const QString &suffix, int rule );
+
+
+
+/*FN**************************************************************************
+
+       AddSuffix( trie, suffix, rule )
+
+   Purpose: Add a suffix to the trie read from its last character on.
+**/
+
+static void AddSuffix( QVector<BuildNode> &trie, const QString &suffix, int rule )
+{
+    int node = 0;
+
+    for(int i=suffix.length()-1; i>=0; i--)
+    {
+        ushort ch = suffix.at(i).unicode();
+        int child = trie.at(node).children.value( ch, -1 );
+        if(-1 == child)
+        {
+            child = trie.size();
+            trie[node].children.insert( ch, child );
+            trie.append( BuildNode() );
+        }
+        node = child;
+    }
+
+    trie[node].rules.append( rule );
+} /* AddSuffix */
+
+
+RuleCompiler::RuleCompiler()
+{
+}
+
+bool RuleCompiler::fail(int number, const QString &message)
+{
+    error = QString( "line %1: %2" ).arg( number ).arg( message );
+    return false;
+}
+
+
+/*FN**************************************************************************
+
+       compile( source )
+
+   Returns: bool -- false on a syntax error, see errorString()
+
+   Purpose: Parse the whole text and lay out its image, image() returns
+            it afterwards.
+**/
+
+bool RuleCompiler::compile(const QString &source)
+{
+    QStringList lines = source.split( '\n' );
+
+    vowels.clear();
+    steps.clear();
+    output.clear();
+    error.clear();
+
+    for(int i=0; i<lines.size(); i++)
+    {
+        if(!parseLine( lines.at(i), i + 1 ))
+            return false;
+    }
+
+    if(steps.isEmpty())
+        return fail( lines.size(), "no steps" );
+
+    build();
+    return true;
+} /* compile */
+
+
+/*FN**************************************************************************
+
+       parseLine( line, number )
+
+   Returns: bool -- false on a syntax error
+
+   Purpose: Handle one vowels or step directive, or one rule of the
+            current step.
+**/
+
+bool RuleCompiler::parseLine(const QString &line, int number)
+{
+    QString text = line;
+    int comment = text.indexOf( '#' );
+    if(comment >= 0)
+        text.truncate( comment );
+
+    QStringList fields = text.simplified().split( ' ', QString::SkipEmptyParts );
+    if(fields.isEmpty())
+        return true;
+
+    if(fields.at(0) == "vowels")
+    {
+        if(2 != fields.size())
+            return fail( number, "vowels takes one word of vowels" );
+        vowels = fields.at(1);
+        return true;
+    }
+
+    if(fields.at(0) == "step")
+    {
+        Step step;
+        if(fields.size() < 3)
+            return fail( number, "step needs a name and a kind" );
+        step.name = fields.at(1);
+        if(fields.at(2) == "suffix")
+            step.kind = RULE_STEP_SUFFIX;
+        else if(fields.at(2) == "word")
+            step.kind = RULE_STEP_WORD;
+        else
+            return fail( number, "step kind must be suffix or word" );
+
+        if(fields.size() > 3)
+        {
+            if(fields.at(3) != "if" || fields.size() < 5)
+                return fail( number, "expected if and rule ids after the step kind" );
+            for(int i=4; i<fields.size(); i++)
+            {
+                bool ok;
+                step.when.append( fields.at(i).toInt( &ok ) );
+                if(!ok || 0 == step.when.last())
+                    return fail( number, "bad rule id " + fields.at(i) );
+            }
+        }
+
+        steps.append( step );
+        return true;
+    }
+
+    if(steps.isEmpty())
+        return fail( number, "rule before the first step" );
+    if(fields.size() < 6 || fields.size() > 7)
+        return fail( number, "a rule is id old_end new_end old_offset new_offset min_root_size [condition]" );
+
+    Rule rule;
+    int *numbers[] = { &rule.id, NULL, NULL, &rule.oldOffset, &rule.newOffset, &rule.minRootSize };
+    for(int i=0; i<6; i++)
+    {
+        bool ok = true;
+        if(NULL != numbers[i])
+            *numbers[i] = fields.at(i).toInt( &ok );
+        if(!ok)
+            return fail( number, "bad number " + fields.at(i) );
+    }
+    if(0 == rule.id)
+        return fail( number, "rule id 0 is reserved" );
+
+    rule.oldEnd = fields.at(1) == "-" ? QString() : fields.at(1);
+    rule.newEnd = fields.at(2) == "-" ? QString() : fields.at(2);
+
+    // the trie matches on old_end alone, so an offset that disagrees
+    // would make the linear scan after a condition match differently
+    if(rule.oldOffset != rule.oldEnd.length() - 1)
+        return fail( number, QString( "old_offset of %1 must be %2" ).arg( fields.at(1) ).arg( rule.oldEnd.length() - 1 ) );
+
+    rule.condition = RULE_CONDITION_NONE;
+    if(7 == fields.size())
+    {
+        for(int c=1; c<RULE_CONDITION_COUNT; c++)
+        {
+            if(fields.at(6) == condition_names[c])
+                rule.condition = c;
+        }
+        if(RULE_CONDITION_NONE == rule.condition)
+            return fail( number, "unknown condition " + fields.at(6) );
+    }
+
+    steps.last().rules.append( rule );
+    return true;
+} /* parseLine */
+
+
+/*FN**************************************************************************
+
+       build()
+
+   Purpose: Lay the parsed steps out as an image.
+
+   Plan:    Rule text goes into one UTF-16 pool.  Each suffix step gets a
+            reversed suffix trie, numbered breadth first so that the
+            children of a node are adjacent and sorted for binary search.
+            Each word step gets an open addressing table of its first
+            rule per word, at most half full.  The header is written
+            last, once every offset is known.
+**/
+
+void RuleCompiler::build()
+{
+    AutomatonHeader header;
+    QVector<AutomatonStep> stepRecords;
+    QVector<AutomatonRule> ruleRecords;
+    QVector<AutomatonNode> nodeRecords;
+    QVector<qint32> indexPool;
+    QVector<ushort> textPool;
+    QByteArray namePool;
+
+    QVector<ushort> vowelSet;
+    for(int i=0; i<vowels.length(); i++)
+    {
+        if(!vowelSet.contains( vowels.at(i).unicode() ))
+            vowelSet.append( vowels.at(i).unicode() );
+    }
+    std::sort( vowelSet.begin(), vowelSet.end() );
+
+    for(int s=0; s<steps.size(); s++)
+    {
+        const Step &step = steps.at(s);
+        AutomatonStep record;
+        memset( &record, 0, sizeof(record) );
+
+        record.name = namePool.size();
+        namePool.append( step.name.toUtf8() );
+        namePool.append( '\0' );
+        record.kind = step.kind;
+        record.firstRule = ruleRecords.size();
+        record.ruleCount = step.rules.size();
+        record.when = indexPool.size();
+        record.whenCount = step.when.size();
+        for(int i=0; i<step.when.size(); i++)
+            indexPool.append( step.when.at(i) );
+
+        for(int r=0; r<step.rules.size(); r++)
+        {
+            const Rule &rule = step.rules.at(r);
+            AutomatonRule out;
+            out.id = rule.id;
+            out.oldText = textPool.size();
+            out.oldLength = rule.oldEnd.length();
+            for(int i=0; i<rule.oldEnd.length(); i++)
+                textPool.append( rule.oldEnd.at(i).unicode() );
+            out.newText = textPool.size();
+            out.newLength = rule.newEnd.length();
+            for(int i=0; i<rule.newEnd.length(); i++)
+                textPool.append( rule.newEnd.at(i).unicode() );
+            out.oldOffset = rule.oldOffset;
+            out.newOffset = rule.newOffset;
+            out.minRootSize = rule.minRootSize;
+            out.condition = rule.condition;
+            ruleRecords.append( out );
+        }
+
+        if(RULE_STEP_SUFFIX == step.kind)
+        {
+            QVector<BuildNode> trie( 1 );
+            for(int r=0; r<step.rules.size(); r++)
+                AddSuffix( trie, step.rules.at(r).oldEnd, r );
+
+            /* Breadth first numbering, order[i] is the trie node placed i-th */
+            QVector<int> order( 1, 0 );
+            QVector<int> placed( trie.size(), 0 );
+            for(int i=0; i<order.size(); i++)
+            {
+                QMap<ushort, int>::const_iterator it;
+                for(it=trie.at(order.at(i)).children.constBegin(); it!=trie.at(order.at(i)).children.constEnd(); ++it)
+                {
+                    placed[it.value()] = order.size();
+                    order.append( it.value() );
+                }
+            }
+
+            record.root = nodeRecords.size();
+            record.nodeCount = order.size();
+            for(int i=0; i<order.size(); i++)
+            {
+                const BuildNode &node = trie.at(order.at(i));
+                AutomatonNode out;
+                out.ch = 0;
+                out.childCount = node.children.size();
+                out.firstChild = node.children.isEmpty() ? 0 : record.root + placed.at(node.children.constBegin().value());
+                out.rules = indexPool.size();
+                out.ruleCount = node.rules.size();
+                for(int r=0; r<node.rules.size(); r++)
+                    indexPool.append( node.rules.at(r) );
+                nodeRecords.append( out );
+            }
+
+            /* Edge characters, now that every node has its place */
+            for(int i=0; i<order.size(); i++)
+            {
+                QMap<ushort, int>::const_iterator it;
+                for(it=trie.at(order.at(i)).children.constBegin(); it!=trie.at(order.at(i)).children.constEnd(); ++it)
+                    nodeRecords[record.root + placed.at(it.value())].ch = it.key();
+            }
+        }
+        else
+        {
+            quint32 slotCount = 1;
+            while(slotCount < 2 * quint32(step.rules.size()) + 1)
+                slotCount *= 2;
+
+            record.slots = indexPool.size();
+            record.slotCount = slotCount;
+            indexPool.insert( indexPool.end(), slotCount, -1 );
+
+            for(int r=0; r<step.rules.size(); r++)
+            {
+                const QString &word = step.rules.at(r).oldEnd;
+                quint32 i = RuleAutomaton::hash( word.constData(), word.length() ) & (slotCount - 1);
+                for(;;)
+                {
+                    qint32 &slot = indexPool[record.slots + i];
+                    if(slot < 0)
+                    {
+                        slot = r;
+                        break;
+                    }
+                    if(step.rules.at(slot).oldEnd == word)
+                        break;      /* the first rule for a word wins */
+                    i = (i + 1) & (slotCount - 1);
+                }
+            }
+        }
+
+        stepRecords.append( record );
+    }
+
+    output.clear();
+    memset( &header, 0, sizeof(header) );
+    AppendSection( output, &header, sizeof(header) );
+    header.magic = RULE_AUTOMATON_MAGIC;
+    header.version = RULE_AUTOMATON_VERSION;
+    header.vowels = AppendSection( output, vowelSet.constData(), vowelSet.size() * sizeof(ushort) );
+    header.vowelCount = vowelSet.size();
+    header.steps = AppendSection( output, stepRecords.constData(), stepRecords.size() * sizeof(AutomatonStep) );
+    header.stepCount = stepRecords.size();
+    header.rules = AppendSection( output, ruleRecords.constData(), ruleRecords.size() * sizeof(AutomatonRule) );
+    header.ruleCount = ruleRecords.size();
+    header.nodes = AppendSection( output, nodeRecords.constData(), nodeRecords.size() * sizeof(AutomatonNode) );
+    header.nodeCount = nodeRecords.size();
+    header.indices = AppendSection( output, indexPool.constData(), indexPool.size() * sizeof(qint32) );
+    header.indexCount = indexPool.size();
+    header.text = AppendSection( output, textPool.constData(), textPool.size() * sizeof(ushort) );
+    header.textLength = textPool.size();
+    header.names = AppendSection( output, namePool.constData(), namePool.size() );
+    header.namesSize = namePool.size();
+    while(0 != output.size() % 4)
+        output.append( '\0' );
+    header.size = output.size();
+    memcpy( output.data(), &header, sizeof(header) );
+} /* build */
@@ -0,0 +1,69 @@
+/******************************************************************
+
+   Compiles a text rule set into the binary image RuleAutomaton runs.
+
+   The text is UTF-8, one directive or rule per line, # starts a
+   comment:
+
+       vowels aeiou
+       step step1b suffix
+       106  ed   -   1 -1 -1  contains_vowel
+       step step1b1 suffix if 106 107
+       step step6 word
+
+   A step is a suffix step (ReplaceEnd) or a word step (ReplaceW),
+   "if" runs it only when the step before fired one of the ids.  A
+   rule is id, old_end, new_end, old_offset, new_offset and
+   min_root_size as in the C tables, - for an empty end, then an
+   optional condition: contains_vowel, add_an_e or remove_an_e.
+   old_offset must be the length of old_end less one.
+
+   Licensed under GPLv3. See LICENCE.md file
+
+**/
+
+#ifndef RULECOMPILER_H
+#define RULECOMPILER_H
+
+#include <QByteArray>
+#include <QString>
+#include <QVector>
+
+class RuleCompiler
+{
+public:
+    RuleCompiler();
+
+    bool compile(const QString &source);
+    QByteArray image() const { return output; }
+    QString errorString() const { return error; }
+
+private:
+    typedef struct {
+               int id;
+               QString oldEnd;
+               QString newEnd;
+               int oldOffset;
+               int newOffset;
+               int minRootSize;
+               int condition;
+               } Rule;
+
+    typedef struct {
+               QString name;
+               int kind;
+               QVector<int> when;  /* ids the step before must fire */
+               QVector<Rule> rules;
+               } Step;
+
+    bool parseLine(const QString &line, int number);
+    bool fail(int number, const QString &message);
+    void build();
+
+    QString vowels;
+    QVector<Step> steps;
+    QByteArray output;
+    QString error;
+};
+
+#endif // RULECOMPILER_H
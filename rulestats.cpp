@@ -0,0 +1,166 @@
+/******************************************************************
+
+   Opt-in per rule counters for the stemmers' rule tables.
+
+   Licensed under GPLv3. See LICENCE.md file
+
+**/
+
+#include "rulestats.h"
+
+RuleStats::RuleStats()
+{
+    reset();
+}
+
+/*FN**************************************************************************
+
+       addStep( step, rules, stride )
+
+   Purpose: Start a rule table.  Its rules follow with addRule(), in table
+            order, before any counting starts.
+**/
+
+void RuleStats::addStep(const char *step, const void *rules, int stride)
+{
+    Q_ASSERT( steps.size() < RULE_STATS_MAX_STEPS );
+
+    Step entry;
+    entry.name = step;
+    entry.rules = static_cast<const char *>( rules );
+    entry.stride = stride;
+    entry.first = ids.size();
+    entry.count = 0;
+
+    stepIndex.insert( rules, steps.size() );
+    steps.append( entry );
+} /* addStep */
+
+void RuleStats::addRule(int id, const QString &suffix)
+{
+    Q_ASSERT( !steps.isEmpty() && ids.size() < RULE_STATS_MAX_RULES );
+
+    ids.append( id );
+    suffixes.append( suffix );
+    stepOf.append( steps.size() - 1 );
+    steps.last().count++;
+} /* addRule */
+
+
+/*FN**************************************************************************
+
+       slot( rule )
+
+   Returns: int -- the counter slot of a rule, -1 if it is not registered
+
+   Plan:    Find the table whose address range holds the rule, the offset
+            into it over the stride is the rule's index.  There are only
+            a few dozen tables.
+**/
+
+int RuleStats::slot(const void *rule) const
+{
+    const char *address = static_cast<const char *>( rule );
+
+    for(int i=0; i<steps.size(); i++)
+    {
+        const Step &step = steps.at(i);
+        if(step.rules <= address && address < step.rules + step.count * step.stride)
+            return step.first + int(address - step.rules) / step.stride;
+    }
+
+    return -1;
+} /* slot */
+
+void RuleStats::called(const void *rules)
+{
+    QHash<const void *, int>::const_iterator it = stepIndex.constFind( rules );
+
+    if(it != stepIndex.constEnd())
+        calls[it.value()].fetchAndAddRelaxed( 1 );
+}
+
+void RuleStats::count(const void *rule, Counter counter)
+{
+    int i = slot( rule );
+
+    if(i >= 0)
+        counters[i][counter].fetchAndAddRelaxed( 1 );
+}
+
+
+/*FN**************************************************************************
+
+       counts()
+
+   Returns: QVector<RuleCount> -- one row per rule, in table order
+
+   Notes:   tested is not counted but derived: a scan reaches a rule
+            exactly when no rule before it in the table fired, so it is
+            the calls of the table less the firings of the rules above.
+            That holds for the compiled tries too, which skip the rules
+            whose suffix cannot match but fire the same rule.
+**/
+
+QVector<RuleCount> RuleStats::counts() const
+{
+    QVector<RuleCount> rows;
+
+    rows.reserve( ids.size() );
+    for(int s=0; s<steps.size(); s++)
+    {
+        const Step &step = steps.at(s);
+        quint64 reached = calls[s].load();
+
+        for(int i=step.first; i<step.first + step.count; i++)
+        {
+            RuleCount row;
+            row.step = step.name;
+            row.id = ids.at(i);
+            row.suffix = suffixes.at(i);
+            row.tested = reached;
+            row.matched = counters[i][Matched].load();
+            row.failedMinRoot = counters[i][FailedMinRoot].load();
+            row.failedCondition = counters[i][FailedCondition].load();
+            row.fired = counters[i][Fired].load();
+            rows.append( row );
+
+            reached -= qMin( reached, row.fired );
+        }
+    }
+
+    return rows;
+} /* counts */
+
+void RuleStats::reset()
+{
+    for(int i=0; i<RULE_STATS_MAX_STEPS; i++)
+        calls[i].store( 0 );
+    for(int i=0; i<RULE_STATS_MAX_RULES; i++)
+        for(int j=0; j<COUNTERS; j++)
+            counters[i][j].store( 0 );
+}
+
+
+/*FN**************************************************************************
+
+       table( counts )
+
+   Returns: QString -- the rows as tab separated text with a header line
+**/
+
+QString RuleStats::table(const QVector<RuleCount> &counts)
+{
+    QString text = "step\tid\tsuffix\ttested\tmatched\tfailed_min_root\tfailed_condition\tfired\n";
+
+    for(int i=0; i<counts.size(); i++)
+    {
+        const RuleCount &row = counts.at(i);
+        text += QString( "%1\t%2\t%3\t%4\t%5\t%6\t%7\t%8\n" )
+                    .arg( row.step ).arg( row.id ).arg( row.suffix )
+                    .arg( row.tested ).arg( row.matched ).arg( row.failedMinRoot )
+                    .arg( row.failedCondition ).arg( row.fired );
+    }
+
+    return text;
+} /* table */
@@ -0,0 +1,82 @@
+/******************************************************************
+
+   Opt-in per rule counters for the stemmers' rule tables.
+
+   Build with "qmake CONFIG+=stemmer_rule_stats" to define
+   STEMMER_RULE_STATS. Without it the counting macros expand to
+   nothing and the stemmers keep no counters at all.
+
+   Licensed under GPLv3. See LICENCE.md file
+
+**/
+
+#ifndef RULESTATS_H
+#define RULESTATS_H
+
+#include <QAtomicInteger>
+#include <QHash>
+#include <QString>
+#include <QVector>
+
+#ifdef STEMMER_RULE_STATS
+#define RULE_STATS_CALL(stats, rules)         (stats)->called( (rules) )
+#define RULE_STATS_COUNT(stats, rule, what)   (stats)->count( (rule), RuleStats::what )
+#else
+#define RULE_STATS_CALL(stats, rules)         ((void)0)
+#define RULE_STATS_COUNT(stats, rule, what)   ((void)0)
+#endif
+
+/* Room for every rule and table of the larger (Latvian) stemmer */
+#define RULE_STATS_MAX_RULES  2048
+#define RULE_STATS_MAX_STEPS  64
+
+typedef struct {
+           const char *step;               /* rule table the rule is in */
+           int id;                         /* RuleList id, unique per table */
+           QString suffix;                 /* old_end, the word for stop words */
+           quint64 tested;                 /* reached by the scan of its table */
+           quint64 matched;                /* suffix matched the word */
+           quint64 failedMinRoot;          /* matched, root too short */
+           quint64 failedCondition;        /* root long enough, condition false */
+           quint64 fired;                  /* replaced the suffix */
+           } RuleCount;
+
+class RuleStats
+{
+public:
+    enum Counter { Matched, FailedMinRoot, FailedCondition, Fired, COUNTERS };
+
+    RuleStats();
+
+    void addStep(const char *step, const void *rules, int stride);
+    void addRule(int id, const QString &suffix);
+
+    void called(const void *rules);
+    void count(const void *rule, Counter counter);
+
+    QVector<RuleCount> counts() const;
+    void reset();
+
+    static QString table(const QVector<RuleCount> &counts);
+
+private:
+    typedef struct {
+               const char *name;
+               const char *rules;          /* first rule of the table */
+               int stride;                 /* sizeof the stemmer's RuleList */
+               int first;                  /* slot of the first rule */
+               int count;                  /* rules in the table */
+               } Step;
+
+    int slot(const void *rule) const;
+
+    QVector<Step> steps;
+    QVector<int> ids;
+    QVector<QString> suffixes;
+    QVector<int> stepOf;
+    QHash<const void *, int> stepIndex;     /* table -> index into steps */
+    QBasicAtomicInteger<quint64> calls[RULE_STATS_MAX_STEPS];
+    QBasicAtomicInteger<quint64> counters[RULE_STATS_MAX_RULES][COUNTERS];
+};
+
+#endif // RULESTATS_H
@@ -0,0 +1,33 @@
+/******************************************************************
+
+   Suffix text of the stemmers' rule tables, kept in static storage.
+
+   U16("ing") is a char16_t literal and its length, so the tables are
+   plain data: no constructor runs for them before main() and they
+   live in read-only pages shared by every process using the library.
+
+   Licensed under GPLv3. See LICENCE.md file
+
+**/
+
+#ifndef RULETEXT_H
+#define RULETEXT_H
+
+#include <QChar>
+
+typedef struct {
+           const char16_t *text;   /* UTF-16 code units, NULL for no text */
+           int length;             /* code units in text */
+           } RuleText;
+
+#define U16(s)  { u"" s, int(sizeof(u"" s) / sizeof(char16_t)) - 1 }
+
+Q_STATIC_ASSERT( sizeof(QChar) == sizeof(char16_t) );
+
+/* The text as QChars, for the buffers the stemmers work on */
+inline const QChar *RuleChars(const RuleText &text)
+{
+    return reinterpret_cast<const QChar *>( text.text );
+}
+
+#endif // RULETEXT_H
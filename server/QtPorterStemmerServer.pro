@@ -0,0 +1,20 @@
+#-------------------------------------------------
+#
+# Batched stemming server over TCP and local sockets
+#
+#-------------------------------------------------
+
+QT       += core network
+QT       -= gui
+
+TARGET = QtPorterStemmerServer
+CONFIG   += console
+CONFIG   -= app_bundle
+TEMPLATE = app
+
+include(../stemmer.pri)
+
+SOURCES += main.cpp \
+    stemserver.cpp
+
+HEADERS  += stemserver.h
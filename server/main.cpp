@@ -0,0 +1,71 @@
+/******************************************************************
+
+   Server tool: stems length prefixed batches of tokens sent over TCP
+   or a local socket, so one warm process serves many clients.
+
+   Licensed under GPLv3. See LICENCE.md file
+
+**/
+
+#include <QCoreApplication>
+#include <QCommandLineParser>
+
+#include <stdio.h>
+
+#include "stemserver.h"
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication a(argc, argv);
+    QCoreApplication::setApplicationName( "QtPorterStemmerServer" );
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription( "Serves batched stemming requests, see stemserver.h for the protocol." );
+    parser.addHelpOption();
+    QCommandLineOption tcpOption( "tcp", "Listen on this TCP port.", "port" );
+    QCommandLineOption hostOption( "host", "Address of the TCP port (default 127.0.0.1).", "address", "127.0.0.1" );
+    QCommandLineOption localOption( "local", "Listen on a local socket of this name.", "name" );
+    QCommandLineOption threadsOption( QStringList() << "j" << "threads", "Worker threads, 0 for one per core (default 0).", "n", "0" );
+    QCommandLineOption cacheOption( "cache", "Stem cache per language in MB (default 64).", "mb", "64" );
+    parser.addOption( tcpOption );
+    parser.addOption( hostOption );
+    parser.addOption( localOption );
+    parser.addOption( threadsOption );
+    parser.addOption( cacheOption );
+    parser.process( a );
+
+    if(!parser.isSet( tcpOption ) && !parser.isSet( localOption ))
+    {
+        fprintf( stderr, "--tcp or --local is required\n" );
+        return 1;
+    }
+
+    StemServer server( parser.value( threadsOption ).toInt(), qint64(qMax( 1, parser.value( cacheOption ).toInt() )) * 1024 * 1024 );
+    QString error;
+
+    if(parser.isSet( tcpOption ))
+    {
+        bool ok;
+        quint16 port = parser.value( tcpOption ).toUShort( &ok );
+        QHostAddress address( parser.value( hostOption ) );
+        if(!ok || address.isNull())
+        {
+            fprintf( stderr, "Bad TCP address %s port %s\n", qPrintable(parser.value( hostOption )), qPrintable(parser.value( tcpOption )) );
+            return 1;
+        }
+        if(!server.listenTcp( address, port, &error ))
+        {
+            fprintf( stderr, "%s: %s\n", qPrintable(parser.value( hostOption )), qPrintable(error) );
+            return 1;
+        }
+        fprintf( stderr, "Listening on %s port %u\n", qPrintable(address.toString()), server.tcpPort() );
+    }
+
+    if(parser.isSet( localOption ) && !server.listenLocal( parser.value( localOption ), &error ))
+    {
+        fprintf( stderr, "%s: %s\n", qPrintable(parser.value( localOption )), qPrintable(error) );
+        return 1;
+    }
+
+    return a.exec();
+}
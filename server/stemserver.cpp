@@ -0,0 +1,401 @@
+/******************************************************************
+
+   Batched stemming server over TCP and local sockets.
+
+   Licensed under GPLv3. See LICENCE.md file
+
+**/
+
+#include "stemserver.h"
+#include "enporterstemmer.h"
+#include "lvporterstemmer.h"
+
+#include <QLocalSocket>
+#include <QTcpSocket>
+#include <QThread>
+#include <QTimer>
+#include <QtConcurrent>
+#include <QtEndian>
+
+#include <stdio.h>
+#include <string.h>
+
+/*****************************************************************************/
+/*****************   Private Defines and Data Structures   *******************/
+
+/* Bytes a socket buffers on its own, so a stalled client hits TCP flow
+   control instead of filling the server's memory */
+#define SOCKET_READ_BUFFER  (1024 * 1024)
+
+static const char *const language_tags[STEM_SERVER_LANGUAGES] = { "lv", "en" };
+
+/*****************************************************************************/
+/********************   Private Function Declarations   **********************/
+static QVector<QByteArray> StemSlices( const QVector<StemSlice> &slices );
+static void PutUint32( QByteArray &out, quint32 value );
+static void Respond( StemRequest &request );
+
+
+/*FN**************************************************************************
+
+       StemSlices( slices )
+
+   Returns: QVector<QByteArray> -- the encoded stems of each slice
+
+   Purpose: The work of one batch, on a pool thread.  Payloads are only
+            read here, everything else about a request is left to the
+            server's thread.
+**/
+
+static QVector<QByteArray> StemSlices( const QVector<StemSlice> &slices )
+{
+    QVector<QByteArray> parts;
+    parts.reserve( slices.size() );
+
+    for(int i=0; i<slices.size(); i++)
+    {
+        const StemSlice &slice = slices.at(i);
+        const char *payload = slice.request->payload.constData();
+        QByteArray out;
+
+        for(int t=slice.first; t<slice.first+slice.count; t++)
+        {
+            int offset = slice.request->tokens.at(t);
+            int length = qFromLittleEndian<quint16>( reinterpret_cast<const uchar *>( payload + offset ) );
+            QByteArray stem = slice.cache->stem( QString::fromUtf8( payload + offset + 2, length ) ).toUtf8();
+
+            // lowering may lengthen UTF-8, a stem that no longer fits
+            // goes back as the word
+            if(stem.size() > 0xffff)
+                stem = QByteArray( payload + offset + 2, length );
+
+            uchar size[2];
+            qToLittleEndian<quint16>( quint16(stem.size()), size );
+            out.append( reinterpret_cast<const char *>( size ), 2 );
+            out.append( stem );
+        }
+        parts.append( out );
+    }
+
+    return parts;
+} /* StemSlices */
+
+static void PutUint32( QByteArray &out, quint32 value )
+{
+    uchar bytes[4];
+
+    qToLittleEndian<quint32>( value, bytes );
+    out.append( reinterpret_cast<const char *>( bytes ), 4 );
+}
+
+/* Assemble the response frame of a request whose slices are all done */
+static void Respond( StemRequest &request )
+{
+    int size = 4;
+    for(int i=0; i<request.parts.size(); i++)
+        size += request.parts.at(i).size();
+
+    request.response.reserve( 4 + size );
+    PutUint32( request.response, size );
+    PutUint32( request.response, request.tokens.size() );
+    for(int i=0; i<request.parts.size(); i++)
+        request.response.append( request.parts.at(i) );
+
+    request.parts.clear();
+    request.payload.clear();
+    request.tokens.clear();
+} /* Respond */
+
+
+ServerConnection::ServerConnection(QIODevice *device, StemServer *server)
+    : QObject( server ), device( device ), server( server )
+{
+    device->setParent( this );
+    connect( device, SIGNAL(readyRead()), this, SLOT(readFrames()) );
+    connect( device, SIGNAL(bytesWritten(qint64)), this, SLOT(readFrames()) );
+    connect( device, SIGNAL(disconnected()), this, SLOT(deleteLater()) );
+}
+
+
+/*FN**************************************************************************
+
+       readFrames()
+
+   Purpose: Take every whole request off the socket and submit it.
+
+   Notes:   Reading stops while STEM_SERVER_PIPELINE requests of this
+            client are unanswered or its unsent responses pass
+            STEM_SERVER_WRITE_LIMIT; flush() and bytesWritten() call
+            this again once that has eased.
+**/
+
+void ServerConnection::readFrames()
+{
+    int consumed = 0;
+
+    while(queue.size() < STEM_SERVER_PIPELINE && device->bytesToWrite() < STEM_SERVER_WRITE_LIMIT)
+    {
+        int size = -1;
+        if(buffer.size() - consumed >= 4)
+        {
+            quint32 frame = qFromLittleEndian<quint32>( reinterpret_cast<const uchar *>( buffer.constData() + consumed ) );
+            if(frame > STEM_SERVER_MAX_FRAME)
+            {
+                fprintf( stderr, "Frame of %u bytes is too large, closing the connection\n", frame );
+                device->close();
+                return;
+            }
+            size = int(frame);
+        }
+
+        if(size >= 0 && buffer.size() - consumed - 4 >= size)
+        {
+            if(!parse( buffer.mid( consumed + 4, size ) ))
+            {
+                fprintf( stderr, "Malformed request, closing the connection\n" );
+                device->close();
+                return;
+            }
+            consumed += 4 + size;
+            continue;
+        }
+
+        if(0 == device->bytesAvailable())
+            break;
+        buffer.remove( 0, consumed );
+        consumed = 0;
+        buffer.append( device->readAll() );
+    }
+
+    buffer.remove( 0, consumed );
+    flush();
+}
+
+
+/*FN**************************************************************************
+
+       parse( payload )
+
+   Returns: bool -- false if the payload is no valid request
+
+   Purpose: Check every token length before anything is queued, so the
+            workers can trust the offsets.
+**/
+
+bool ServerConnection::parse(const QByteArray &payload)
+{
+    if(payload.size() < 8)
+        return false;
+
+    const uchar *data = reinterpret_cast<const uchar *>( payload.constData() );
+    int language = StemServer::language( payload.constData() );
+    quint32 count = qFromLittleEndian<quint32>( data + 4 );
+    if(language < 0 || count > quint32(payload.size() - 8) / 2)
+        return false;
+
+    StemRequestPointer request( new StemRequest );
+    request->connection = this;
+    request->language = language;
+    request->pending = 0;
+    request->tokens.reserve( count );
+
+    int offset = 8;
+    for(quint32 i=0; i<count; i++)
+    {
+        if(payload.size() - offset < 2)
+            return false;
+        int length = qFromLittleEndian<quint16>( data + offset );
+        if(payload.size() - offset - 2 < length)
+            return false;
+        request->tokens.append( offset );
+        offset += 2 + length;
+    }
+    if(offset != payload.size())
+        return false;
+
+    request->payload = payload;
+    queue.enqueue( request );
+    server->submit( request );
+
+    return true;
+}
+
+void ServerConnection::flush()
+{
+    bool wrote = false;
+
+    while(!queue.isEmpty() && 0 == queue.head()->pending)
+    {
+        device->write( queue.dequeue()->response );
+        wrote = true;
+    }
+
+    // reading may have stopped on a full queue, so look at what waits
+    if(wrote && (!buffer.isEmpty() || device->bytesAvailable() > 0))
+        QMetaObject::invokeMethod( this, "readFrames", Qt::QueuedConnection );
+}
+
+
+StemServer::StemServer(int threads, qint64 cacheBytes, QObject *parent)
+    : QObject( parent ), dispatchQueued( false )
+{
+    caches[0] = new StemCache( LVPorterStemmer::stem, cacheBytes );
+    caches[1] = new StemCache( ENPorterStemmer::stem, cacheBytes );
+    for(int i=0; i<STEM_SERVER_LANGUAGES; i++)
+        batches[i].tokens = 0;
+
+    pool.setMaxThreadCount( threads > 0 ? threads : QThread::idealThreadCount() );
+
+    connect( &tcp, SIGNAL(newConnection()), this, SLOT(acceptTcp()) );
+    connect( &local, SIGNAL(newConnection()), this, SLOT(acceptLocal()) );
+}
+
+StemServer::~StemServer()
+{
+    pool.waitForDone();
+    for(int i=0; i<STEM_SERVER_LANGUAGES; i++)
+        delete caches[i];
+}
+
+bool StemServer::listenTcp(const QHostAddress &address, quint16 port, QString *error)
+{
+    if(tcp.listen( address, port ))
+        return true;
+
+    *error = tcp.errorString();
+    return false;
+}
+
+bool StemServer::listenLocal(const QString &name, QString *error)
+{
+    QLocalServer::removeServer( name );
+    if(local.listen( name ))
+        return true;
+
+    *error = local.errorString();
+    return false;
+}
+
+int StemServer::language(const char *tag)
+{
+    for(int i=0; i<STEM_SERVER_LANGUAGES; i++)
+    {
+        char padded[4] = { 0, 0, 0, 0 };
+        memcpy( padded, language_tags[i], strlen( language_tags[i] ) );
+        if(0 == memcmp( padded, tag, 4 ))
+            return i;
+    }
+
+    return -1;
+}
+
+void StemServer::acceptTcp()
+{
+    while(tcp.hasPendingConnections())
+    {
+        QTcpSocket *socket = tcp.nextPendingConnection();
+        socket->setReadBufferSize( SOCKET_READ_BUFFER );
+        new ServerConnection( socket, this );
+    }
+}
+
+void StemServer::acceptLocal()
+{
+    while(local.hasPendingConnections())
+    {
+        QLocalSocket *socket = local.nextPendingConnection();
+        socket->setReadBufferSize( SOCKET_READ_BUFFER );
+        new ServerConnection( socket, this );
+    }
+}
+
+
+/*FN**************************************************************************
+
+       submit( request )
+
+   Purpose: Add the tokens of a request to the batch of its language.
+
+   Plan:    A request larger than what the batch still takes is cut
+            into slices, so a big request is stemmed by several workers
+            while small ones share a batch.  Full batches go to the
+            pool at once.  The rest wait for dispatch(), which runs once
+            the event loop has read everything that arrived together and
+            only sends a batch while a worker is free.  Under load the
+            batches therefore grow instead of queuing.
+**/
+
+void StemServer::submit(const StemRequestPointer &request)
+{
+    Batch &batch = batches[request->language];
+    int count = request->tokens.size();
+    int parts = 0;
+
+    for(int first=0; first<count; )
+    {
+        StemSlice slice = { request, caches[request->language], parts++, first,
+                            qMin( count - first, STEM_SERVER_BATCH - batch.tokens ) };
+        batch.slices.append( slice );
+        batch.tokens += slice.count;
+        first += slice.count;
+
+        if(batch.tokens >= STEM_SERVER_BATCH)
+            send( batch );
+    }
+
+    request->parts.resize( parts );
+    request->pending = parts;
+    if(0 == parts)
+        Respond( *request );
+
+    if(!dispatchQueued)
+    {
+        dispatchQueued = true;
+        QTimer::singleShot( 0, this, SLOT(dispatch()) );
+    }
+}
+
+void StemServer::dispatch()
+{
+    dispatchQueued = false;
+
+    for(int i=0; i<STEM_SERVER_LANGUAGES; i++)
+    {
+        if(batches[i].tokens > 0 && running.size() < pool.maxThreadCount())
+            send( batches[i] );
+    }
+}
+
+void StemServer::send(Batch &batch)
+{
+    QFutureWatcher<QVector<QByteArray> > *watcher = new QFutureWatcher<QVector<QByteArray> >( this );
+
+    running.insert( watcher, batch.slices );
+    connect( watcher, SIGNAL(finished()), this, SLOT(batchDone()) );
+    watcher->setFuture( QtConcurrent::run( &pool, StemSlices, batch.slices ) );
+
+    batch.slices.clear();
+    batch.tokens = 0;
+}
+
+void StemServer::batchDone()
+{
+    QFutureWatcher<QVector<QByteArray> > *watcher = static_cast<QFutureWatcher<QVector<QByteArray> > *>( sender() );
+    QVector<StemSlice> slices = running.take( watcher );
+    QVector<QByteArray> parts = watcher->result();
+    watcher->deleteLater();
+
+    for(int i=0; i<slices.size(); i++)
+    {
+        StemRequest &request = *slices.at(i).request;
+        request.parts[slices.at(i).part] = parts.at(i);
+        if(0 == --request.pending)
+        {
+            Respond( request );
+            if(!request.connection.isNull())
+                request.connection->flush();
+        }
+    }
+
+    dispatch();
+}
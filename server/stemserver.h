@@ -0,0 +1,137 @@
+/******************************************************************
+
+   Batched stemming server over TCP and local sockets.
+
+   Every frame, either way, is a little endian quint32 payload size
+   and the payload.  A request payload is a 4 byte language tag ("lv"
+   or "en", NUL padded), a quint32 token count and the tokens, each a
+   quint16 byte length and that many bytes of UTF-8.  The response
+   payload is the token count and the stems in the same encoding and
+   order.  A client may send any number of requests without waiting,
+   the responses come back in request order.  A malformed request
+   closes the connection.
+
+   Licensed under GPLv3. See LICENCE.md file
+
+**/
+
+#ifndef STEMSERVER_H
+#define STEMSERVER_H
+
+#include <QByteArray>
+#include <QHash>
+#include <QHostAddress>
+#include <QIODevice>
+#include <QLocalServer>
+#include <QObject>
+#include <QPointer>
+#include <QQueue>
+#include <QSharedPointer>
+#include <QTcpServer>
+#include <QThreadPool>
+#include <QVector>
+
+#include "stemcache.h"
+
+#define STEM_SERVER_MAX_FRAME    (16 * 1024 * 1024)   /* larger payloads close the connection */
+#define STEM_SERVER_BATCH        512                  /* tokens a batch is sent to the pool at */
+#define STEM_SERVER_PIPELINE     64                   /* requests in flight per connection */
+#define STEM_SERVER_WRITE_LIMIT  (4 * 1024 * 1024)    /* unsent response bytes that pause reading */
+
+#define STEM_SERVER_LANGUAGES    2                    /* index 0 "lv", 1 "en" */
+
+class ServerConnection;
+class StemServer;
+
+/* One request, shared by its connection and the batches stemming it */
+typedef struct {
+           QPointer<ServerConnection> connection;  /* NULL once the client is gone */
+           int language;               /* index into the server's caches */
+           QByteArray payload;         /* the request, read only while stemming */
+           QVector<int> tokens;        /* offset of each token's length in payload */
+           QVector<QByteArray> parts;  /* encoded stems of each slice of tokens */
+           int pending;                /* slices still being stemmed */
+           QByteArray response;        /* the whole frame, once pending is 0 */
+           } StemRequest;
+
+typedef QSharedPointer<StemRequest> StemRequestPointer;
+
+/* Tokens [first, first + count) of a request, stemmed as one piece */
+typedef struct {
+           StemRequestPointer request;
+           StemCache *cache;
+           int part;                   /* index into request->parts */
+           int first;
+           int count;
+           } StemSlice;
+
+class ServerConnection : public QObject
+{
+    Q_OBJECT
+
+public:
+    // Takes over the socket, a QTcpSocket or a QLocalSocket.
+    ServerConnection(QIODevice *device, StemServer *server);
+
+    // Writes the finished responses at the head of the queue.
+    void flush();
+
+private slots:
+    void readFrames();
+
+private:
+    bool parse(const QByteArray &payload);
+
+    QIODevice *device;
+    StemServer *server;
+    QByteArray buffer;             /* bytes read but not yet framed */
+    QQueue<StemRequestPointer> queue;   /* requests in arrival order */
+};
+
+class StemServer : public QObject
+{
+    Q_OBJECT
+
+public:
+    // threads <= 0 means one per core; each language gets a stem cache
+    // of cacheBytes shared by the workers.
+    StemServer(int threads, qint64 cacheBytes, QObject *parent = 0);
+    ~StemServer();
+
+    bool listenTcp(const QHostAddress &address, quint16 port, QString *error);
+    bool listenLocal(const QString &name, QString *error);
+    quint16 tcpPort() const { return tcp.serverPort(); }
+
+    // Index of a 4 byte language tag, -1 if there is no such stemmer.
+    static int language(const char *tag);
+
+    // Queues the tokens of a parsed request for stemming.
+    void submit(const StemRequestPointer &request);
+
+private slots:
+    void acceptTcp();
+    void acceptLocal();
+    void dispatch();
+    void batchDone();
+
+private:
+    Q_DISABLE_COPY(StemServer)
+
+    typedef struct {
+               QVector<StemSlice> slices;
+               int tokens;
+               } Batch;
+
+    void send(Batch &batch);
+
+    StemCache *caches[STEM_SERVER_LANGUAGES];
+    Batch batches[STEM_SERVER_LANGUAGES];  /* filling up, one per language */
+    QHash<QObject *, QVector<StemSlice> > running;  /* watcher -> its batch */
+    QThreadPool pool;
+    bool dispatchQueued;
+
+    QTcpServer tcp;
+    QLocalServer local;
+};
+
+#endif // STEMSERVER_H
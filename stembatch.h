@@ -0,0 +1,63 @@
+/******************************************************************
+
+   Batch stemming helper shared by ENPorterStemmer and LVPorterStemmer.
+
+   Licensed under GPLv3. See LICENCE.md file
+
+**/
+
+#ifndef STEMBATCH_H
+#define STEMBATCH_H
+
+#include <QStringList>
+#include <QVector>
+#include <QtConcurrent>
+
+/* Words handed to a single pool task. Large enough to hide the cost of
+   scheduling a task, small enough to keep every core busy at the end. */
+#define STEM_BATCH_CHUNK 2048
+
+typedef struct {
+           const QStringList *words;   /* whole input list */
+           int begin;                  /* first word of this chunk */
+           int end;                    /* one past the last word */
+           QStringList stems;          /* stems of words[begin..end) */
+           } StemBatchChunk;
+
+template <QString (*StemFn)(QString)>
+void StemBatchRun( StemBatchChunk &chunk )
+{
+    chunk.stems.reserve( chunk.end - chunk.begin );
+    for(int i=chunk.begin; i<chunk.end; i++)
+        chunk.stems.append( StemFn( chunk.words->at(i) ) );
+}
+
+/* Stems every word on the global QThreadPool and returns the stems in
+   input order. */
+template <QString (*StemFn)(QString)>
+QStringList StemBatch( const QStringList &words )
+{
+    QVector<StemBatchChunk> chunks;
+    for(int begin=0; begin<words.size(); begin+=STEM_BATCH_CHUNK)
+    {
+        StemBatchChunk chunk;
+        chunk.words = &words;
+        chunk.begin = begin;
+        chunk.end = qMin( begin + STEM_BATCH_CHUNK, words.size() );
+        chunks.append( chunk );
+    }
+
+    if(chunks.size() == 1)
+        StemBatchRun<StemFn>( chunks[0] );
+    else if(chunks.size() > 1)
+        QtConcurrent::blockingMap( chunks, StemBatchRun<StemFn> );
+
+    QStringList result;
+    result.reserve( words.size() );
+    for(int i=0; i<chunks.size(); i++)
+        result.append( chunks.at(i).stems );
+
+    return result;
+}
+
+#endif // STEMBATCH_H
@@ -0,0 +1,197 @@
+/******************************************************************
+
+   Bounded, thread safe memo of stem() results.
+
+   Licensed under GPLv3. See LICENCE.md file
+
+**/
+
+#include "stemcache.h"
+
+#include <QMutexLocker>
+
+/* Rough per-entry cost on top of the characters: hash node, two QString
+   headers and the slot itself */
+#define ENTRY_OVERHEAD 96
+
+StemCache::StemCache(StemFunction stemFunction, qint64 maxBytes, int shardCount) :
+    stemFunction(stemFunction)
+{
+    if(shardCount < 1)
+        shardCount = 1;
+
+    shardBytes = maxBytes / shardCount;
+    for(int i=0; i<shardCount; i++)
+    {
+        Shard *shard = new Shard;
+        shard->hand = 0;
+        shard->bytes = 0;
+        shard->hits = 0;
+        shard->misses = 0;
+        shard->evictions = 0;
+        shards.append( shard );
+    }
+}
+
+StemCache::~StemCache()
+{
+    qDeleteAll( shards );
+}
+
+qint64 StemCache::entryBytes(const QString &word, const QString &stem)
+{
+    return ENTRY_OVERHEAD + (word.size() + stem.size()) * sizeof(QChar);
+}
+
+/*FN**************************************************************************
+
+       stem( word )
+
+   Returns: QString -- the same stem stemFunction would return for word
+
+   Purpose: Answer repeated words from memory.
+
+   Plan:    Key on the lowered word, which QString::toLower() hands back
+            without a copy when the word is lower case already, and pick
+            the shard from its hash.  The stemmer runs outside the shard
+            lock so misses on one shard do not serialize.
+**/
+
+QString StemCache::stem(const QString &word)
+{
+    QString key = word.toLower();
+
+    // an empty word would look like a free slot, and costs nothing to stem
+    if(key.isEmpty())
+        return stemFunction( key );
+
+    Shard &shard = *shards.at( qHash(key) % uint(shards.size()) );
+
+    {
+        QMutexLocker locker( &shard.lock );
+        QHash<QString, int>::const_iterator it = shard.index.constFind( key );
+        if(it != shard.index.constEnd())
+        {
+            Entry &entry = shard.entries[it.value()];
+            entry.referenced = true;
+            shard.hits++;
+            return entry.stem;
+        }
+        shard.misses++;
+    }
+
+    QString stem = stemFunction( key );
+
+    QMutexLocker locker( &shard.lock );
+    if(!shard.index.contains( key ))
+        insert( shard, key, stem );
+
+    return stem;
+} /* stem */
+
+
+/*FN**************************************************************************
+
+       insert( shard, word, stem )
+
+   Purpose: Add an entry to a locked shard, evicting others until it fits.
+
+   Plan:    CLOCK: the hand sweeps the slots, giving every referenced
+            entry a second chance by clearing its bit, and evicts the
+            first one found unreferenced.  Freed slots are reused.  A
+            whole sweep that neither evicts nor clears a bit finds
+            nothing it could ever free, so the entry is then left out.
+**/
+
+void StemCache::insert(Shard &shard, const QString &word, const QString &stem)
+{
+    qint64 bytes = entryBytes( word, stem );
+    int slot;
+    int idle = 0;                  /* slots swept since the last change */
+
+    if(bytes > shardBytes)
+        return;
+
+    while(shard.bytes + bytes > shardBytes)
+    {
+        if(idle >= shard.entries.size())
+            return;
+        if(shard.hand >= shard.entries.size())
+            shard.hand = 0;
+
+        Entry &entry = shard.entries[shard.hand];
+        if(entry.word.isEmpty())
+            idle++;
+        else if(entry.referenced)
+        {
+            entry.referenced = false;
+            idle = 0;
+        }
+        else
+        {
+            idle = 0;
+            shard.bytes -= entryBytes( entry.word, entry.stem );
+            shard.index.remove( entry.word );
+            entry.word.clear();
+            entry.stem.clear();
+            shard.freeSlots.append( shard.hand );
+            shard.evictions++;
+        }
+        shard.hand++;
+    }
+
+    Entry added;
+    added.word = word;
+    added.stem = stem;
+    added.referenced = false;
+
+    if(shard.freeSlots.isEmpty())
+    {
+        slot = shard.entries.size();
+        shard.entries.append( added );
+    }
+    else
+    {
+        slot = shard.freeSlots.takeLast();
+        shard.entries[slot] = added;
+    }
+
+    shard.index.insert( word, slot );
+    shard.bytes += bytes;
+} /* insert */
+
+
+StemCache::Stats StemCache::stats() const
+{
+    Stats total = { 0, 0, 0, 0, 0 };
+
+    for(int i=0; i<shards.size(); i++)
+    {
+        const Shard &shard = *shards.at(i);
+        QMutexLocker locker( &shard.lock );
+        total.hits += shard.hits;
+        total.misses += shard.misses;
+        total.evictions += shard.evictions;
+        total.bytes += shard.bytes;
+        total.entries += shard.index.size();
+    }
+
+    return total;
+}
+
+void StemCache::clear()
+{
+    for(int i=0; i<shards.size(); i++)
+    {
+        Shard &shard = *shards.at(i);
+        QMutexLocker locker( &shard.lock );
+        shard.index.clear();
+        shard.entries.clear();
+        shard.freeSlots.clear();
+        shard.hand = 0;
+        shard.bytes = 0;
+        shard.hits = 0;
+        shard.misses = 0;
+        shard.evictions = 0;
+    }
+}
@@ -0,0 +1,67 @@
+/******************************************************************
+
+   Bounded, thread safe memo of stem() results.
+
+   Licensed under GPLv3. See LICENCE.md file
+
+**/
+
+#ifndef STEMCACHE_H
+#define STEMCACHE_H
+
+#include <QHash>
+#include <QMutex>
+#include <QString>
+#include <QVector>
+
+class StemCache
+{
+public:
+    typedef QString (*StemFunction)(QString);
+
+    typedef struct {
+               quint64 hits;           /* lookups answered from the cache */
+               quint64 misses;         /* lookups that had to stem */
+               quint64 evictions;      /* entries dropped to stay under the cap */
+               qint64 bytes;           /* estimated memory held by entries */
+               int entries;            /* words currently cached */
+               } Stats;
+
+    explicit StemCache(StemFunction stemFunction, qint64 maxBytes = 64 * 1024 * 1024, int shardCount = 16);
+    ~StemCache();
+
+    QString stem(const QString &word);
+
+    Stats stats() const;
+    void clear();
+
+private:
+    typedef struct {
+               QString word;           /* lowered word, empty if slot is free */
+               QString stem;
+               bool referenced;        /* CLOCK bit, set on every hit */
+               } Entry;
+
+    typedef struct {
+               mutable QMutex lock;
+               QHash<QString, int> index;  /* lowered word -> slot in entries */
+               QVector<Entry> entries;
+               QVector<int> freeSlots;     /* evicted slots waiting for reuse */
+               int hand;                   /* CLOCK hand into entries */
+               qint64 bytes;
+               quint64 hits;
+               quint64 misses;
+               quint64 evictions;
+               } Shard;
+
+    static qint64 entryBytes(const QString &word, const QString &stem);
+    void insert(Shard &shard, const QString &word, const QString &stem);
+
+    StemFunction stemFunction;
+    qint64 shardBytes;             /* memory cap of each shard */
+    QVector<Shard *> shards;
+
+    Q_DISABLE_COPY(StemCache)
+};
+
+#endif // STEMCACHE_H
@@ -0,0 +1,17 @@
+#-------------------------------------------------
+#
+# Precomputes a word -> stem dictionary for a vocabulary
+#
+#-------------------------------------------------
+
+QT       += core
+QT       -= gui
+
+TARGET = QtPorterStemmerDict
+CONFIG   += console
+CONFIG   -= app_bundle
+TEMPLATE = app
+
+include(../stemmer.pri)
+
+SOURCES += main.cpp
@@ -0,0 +1,123 @@
+/******************************************************************
+
+   Dictionary builder: stems every distinct word of a vocabulary and
+   writes the pairs as a StemDictionary image.
+
+   Licensed under GPLv3. See LICENCE.md file
+
+**/
+
+#include <QCoreApplication>
+#include <QCommandLineParser>
+#include <QFile>
+#include <QSet>
+
+#include <stdio.h>
+
+#include "enporterstemmer.h"
+#include "lvporterstemmer.h"
+#include "stemdictionary.h"
+
+#define IsSpace(c)  (' '==(c)||'\n'==(c)||'\t'==(c)||'\r'==(c)||'\f'==(c)||'\v'==(c))
+
+/*FN**************************************************************************
+
+       AddWords( text, seen, words )
+
+   Purpose: Append the whitespace separated words of text that are not
+            in seen yet.
+**/
+
+static void AddWords(const QByteArray &text, QSet<QString> &seen, QStringList &words)
+{
+    const char *p = text.constData();
+    const char *end = p + text.size();
+
+    while(p < end)
+    {
+        while(p < end && IsSpace(*p))
+            p++;
+
+        const char *token = p;
+        while(p < end && !IsSpace(*p))
+            p++;
+
+        if(p > token)
+        {
+            QString word = QString::fromUtf8( token, int(p - token) );
+            if(!seen.contains( word ))
+            {
+                seen.insert( word );
+                words.append( word );
+            }
+        }
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    QCoreApplication a(argc, argv);
+    QCoreApplication::setApplicationName( "QtPorterStemmerDict" );
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription( "Stems a vocabulary of whitespace separated UTF-8 words into a stem dictionary." );
+    parser.addHelpOption();
+    QCommandLineOption langOption( QStringList() << "l" << "lang", "Stemmer language, lv or en (default lv).", "lang", "lv" );
+    QCommandLineOption outputOption( QStringList() << "o" << "output", "Dictionary to write.", "file" );
+    parser.addOption( langOption );
+    parser.addOption( outputOption );
+    parser.addPositionalArgument( "files", "Vocabulary files, stdin when none or -.", "[files...]" );
+    parser.process( a );
+
+    QString lang = parser.value( langOption );
+    if(lang != "lv" && lang != "en")
+    {
+        fprintf( stderr, "Unknown language %s\n", qPrintable(lang) );
+        return 1;
+    }
+    if(!parser.isSet( outputOption ))
+    {
+        fprintf( stderr, "-o is required\n" );
+        return 1;
+    }
+
+    QStringList files = parser.positionalArguments();
+    if(files.isEmpty())
+        files << "-";
+
+    QSet<QString> seen;
+    QStringList words;
+    foreach(const QString &name, files)
+    {
+        QFile in;
+        bool opened;
+        if(name == "-")
+            opened = in.open( stdin, QIODevice::ReadOnly );
+        else
+        {
+            in.setFileName( name );
+            opened = in.open( QIODevice::ReadOnly );
+        }
+
+        if(!opened)
+        {
+            fprintf( stderr, "%s: %s\n", qPrintable(name), qPrintable(in.errorString()) );
+            return 1;
+        }
+        AddWords( in.readAll(), seen, words );
+    }
+
+    QStringList stems = lang == "en" ? ENPorterStemmer::stemBatch( words ) : LVPorterStemmer::stemBatch( words );
+    QByteArray image = StemDictionary::build( lang, words, stems );
+
+    QString outName = parser.value( outputOption );
+    QFile out( outName );
+    if(!out.open( QIODevice::WriteOnly ) || out.write( image ) != image.size() || !out.flush())
+    {
+        fprintf( stderr, "%s: %s\n", qPrintable(outName), qPrintable(out.errorString()) );
+        return 1;
+    }
+
+    fprintf( stderr, "%d words, %d bytes\n", words.size(), image.size() );
+    return 0;
+}
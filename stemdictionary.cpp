@@ -0,0 +1,288 @@
+/******************************************************************
+
+   Precomputed word -> stem dictionary for a known vocabulary, kept in
+   a flat image that is memory mapped and used in place.
+
+   Licensed under GPLv3. See LICENCE.md file
+
+**/
+
+#include "stemdictionary.h"
+#include "utf8text.h"
+
+#include <QMap>
+#include <QVarLengthArray>
+#include <QVector>
+
+#include <string.h>
+
+StemDictionary::StemDictionary(StemFunction stemFunction)
+    : stemFunction( stemFunction ), header( NULL )
+{
+}
+
+/*FN**************************************************************************
+
+       load( fileName )
+
+   Returns: bool -- false if the file cannot be mapped or is no valid image
+
+   Purpose: Map a dictionary.  Only the header is checked, pages of the
+            table and the pool are read in by the lookups that touch
+            them and are shared with every other process mapping the
+            same file.
+**/
+
+bool StemDictionary::load(const QString &fileName)
+{
+    header = NULL;
+    if(!mapped.map( fileName, &error ))
+        return false;
+
+    if(!attach( mapped.data(), mapped.size() ))
+        return fail( fileName + ": " + error );
+
+    return true;
+} /* load */
+
+bool StemDictionary::setImage(const QByteArray &image)
+{
+    header = NULL;
+    mapped.setImage( image );
+
+    return attach( mapped.data(), mapped.size() );
+}
+
+bool StemDictionary::fail(const QString &message)
+{
+    header = NULL;
+    error = message;
+    return false;
+}
+
+
+/*FN**************************************************************************
+
+       attach( image, size )
+
+   Returns: bool -- false if the image is not a valid dictionary
+
+   Purpose: Check the header and that both sections lie in the image.
+
+   Notes:   Records are not walked here, that would read the whole file
+            on every start.  find() checks each record it decodes
+            against the end of the pool instead.
+**/
+
+bool StemDictionary::attach(const uchar *image, qint64 size)
+{
+    const DictionaryHeader *head = reinterpret_cast<const DictionaryHeader *>( image );
+
+    if(!CheckImageHeader( image, size, sizeof(DictionaryHeader), STEM_DICTIONARY_MAGIC,
+                          STEM_DICTIONARY_VERSION, "stem dictionary", &error ))
+        return false;
+    if(0 != head->language[3])
+        return fail( "stem dictionary language is not terminated" );
+
+    if(0 == head->slotCount || 0 != (head->slotCount & (head->slotCount - 1))
+            || head->maxProbe >= head->slotCount || head->wordCount >= head->slotCount)
+        return fail( "stem dictionary table is invalid" );
+    if(0 != head->slots % 4 || head->slots > size
+            || quint64(head->slotCount) * sizeof(DictionarySlot) > quint64(size - head->slots)
+            || head->pool > size || head->poolSize > size - head->pool)
+        return fail( "stem dictionary section out of range" );
+
+    slots = reinterpret_cast<const DictionarySlot *>( image + head->slots );
+    pool = image + head->pool;
+    header = head;
+    error.clear();
+
+    return true;
+} /* attach */
+
+QString StemDictionary::language() const
+{
+    return NULL == header ? QString() : QString::fromLatin1( header->language );
+}
+
+int StemDictionary::size() const
+{
+    return NULL == header ? 0 : int(header->wordCount);
+}
+
+
+/*FN**************************************************************************
+
+       find( word, length, out, capacity )
+
+   Returns: int -- byte length of the stem, -1 if word is not listed
+
+   Purpose: Probe the table from the word's hash.  The stored hash
+            rejects almost every other word before its record is read.
+
+   Notes:   A probe never goes past maxProbe slots, the longest sequence
+            the builder made, so even a table without a free slot ends.
+**/
+
+int StemDictionary::find(const char *word, int length, char *out, int capacity) const
+{
+    if(NULL == header || length < 0)
+        return -1;
+
+    quint32 h = hash( word, length );
+    quint32 mask = header->slotCount - 1;
+    const uchar *end = pool + header->poolSize;
+
+    quint32 i = h & mask;
+    for(quint32 probe=0; probe<=header->maxProbe; probe++, i=(i + 1) & mask)
+    {
+        const DictionarySlot &slot = slots[i];
+        if(STEM_DICTIONARY_FREE == slot.record)
+            return -1;
+        if(h != slot.hash || slot.record >= header->poolSize)
+            continue;
+
+        quint32 wordLength, shared, tailLength;
+        const uchar *p = GetVarint( pool + slot.record, end, &wordLength );
+        if(NULL == p || quint32(length) != wordLength || wordLength > quint32(end - p)
+                || 0 != memcmp( p, word, length ))
+            continue;
+
+        p = GetVarint( p + wordLength, end, &shared );
+        if(NULL != p)
+            p = GetVarint( p, end, &tailLength );
+        if(NULL == p || shared > wordLength || tailLength > quint32(end - p))
+            return -1;
+
+        int size = int(shared + tailLength);
+        if(size <= capacity)
+        {
+            memcpy( out, word, shared );
+            memcpy( out + shared, p, tailLength );
+        }
+        return size;
+    }
+
+    return -1;
+} /* find */
+
+QString StemDictionary::stem(const QString &word) const
+{
+    QVarLengthArray<char, 256> utf8( 3 * word.length() );
+    int length = Utf16ToUtf8( word.constData(), word.length(), utf8.data() );
+
+    QVarLengthArray<char, 256> out( length + 16 );
+    int size = find( utf8.constData(), length, out.data(), out.size() );
+    if(size > out.size())
+    {
+        out.resize( size );
+        size = find( utf8.constData(), length, out.data(), out.size() );
+    }
+
+    if(size >= 0)
+        return QString::fromUtf8( out.constData(), size );
+
+    return NULL == stemFunction ? word : stemFunction( word );
+}
+
+
+/*FN**************************************************************************
+
+       build( language, words, stems )
+
+   Returns: QByteArray -- the image, for setImage() or to write to a file
+
+   Purpose: Lay out a dictionary of the given pairs.
+
+   Plan:    Words are encoded and sorted by their bytes, so records of
+            related forms sit next to each other in the pool.  The table
+            is kept at most two thirds full, linear probing from the
+            hash, and remembers the longest probe it needed.
+**/
+
+QByteArray StemDictionary::build(const QString &language, const QStringList &words, const QStringList &stems)
+{
+    QMap<QByteArray, QByteArray> sorted;
+    for(int i=0; i<words.size() && i<stems.size(); i++)
+    {
+        QByteArray word = words.at(i).toUtf8();
+        if(!sorted.contains( word ))
+            sorted.insert( word, stems.at(i).toUtf8() );
+    }
+
+    QByteArray records;
+    QVector<quint32> offsets;
+    QMap<QByteArray, QByteArray>::const_iterator it;
+    for(it=sorted.constBegin(); it!=sorted.constEnd(); ++it)
+    {
+        const QByteArray &word = it.key();
+        const QByteArray &stem = it.value();
+        int shared = 0;
+        while(shared < word.size() && shared < stem.size() && word.at(shared) == stem.at(shared))
+            shared++;
+
+        offsets.append( records.size() );
+        PutVarint( records, word.size() );
+        records.append( word );
+        PutVarint( records, shared );
+        PutVarint( records, stem.size() - shared );
+        records.append( stem.constData() + shared, stem.size() - shared );
+    }
+
+    quint32 slotCount = 1;
+    while(slotCount < 3 * quint32(offsets.size()) / 2 + 1)
+        slotCount *= 2;
+
+    DictionarySlot empty = { 0, STEM_DICTIONARY_FREE };
+    QVector<DictionarySlot> table( slotCount, empty );
+    quint32 maxProbe = 0;
+    int n = 0;
+    for(it=sorted.constBegin(); it!=sorted.constEnd(); ++it, n++)
+    {
+        quint32 h = hash( it.key().constData(), it.key().size() );
+        quint32 i = h & (slotCount - 1);
+        quint32 probe = 0;
+        while(STEM_DICTIONARY_FREE != table.at(i).record)
+        {
+            i = (i + 1) & (slotCount - 1);
+            probe++;
+        }
+        table[i].hash = h;
+        table[i].record = offsets.at(n);
+        maxProbe = qMax( maxProbe, probe );
+    }
+
+    DictionaryHeader header;
+    QByteArray image;
+    memset( &header, 0, sizeof(header) );
+    AppendSection( image, &header, sizeof(header) );
+    header.magic = STEM_DICTIONARY_MAGIC;
+    header.version = STEM_DICTIONARY_VERSION;
+    QByteArray tag = language.toLatin1().left( 3 );
+    memcpy( header.language, tag.constData(), tag.size() );
+    header.wordCount = offsets.size();
+    header.slots = AppendSection( image, table.constData(), table.size() * sizeof(DictionarySlot) );
+    header.slotCount = slotCount;
+    header.maxProbe = maxProbe;
+    header.pool = AppendSection( image, records.constData(), records.size() );
+    header.poolSize = records.size();
+    while(0 != image.size() % 4)
+        image.append( '\0' );
+    header.size = image.size();
+    memcpy( image.data(), &header, sizeof(header) );
+
+    return image;
+} /* build */
+
+quint32 StemDictionary::hash(const char *word, int length)
+{
+    quint32 h = 2166136261u;
+
+    for(int i=0; i<length; i++)
+    {
+        h ^= uchar(word[i]);
+        h *= 16777619u;
+    }
+
+    return h;
+} /* hash */
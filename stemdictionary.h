@@ -0,0 +1,92 @@
+/******************************************************************
+
+   Precomputed word -> stem dictionary for a known vocabulary, kept in
+   a flat image that is memory mapped and used in place.
+
+   The image is a header, an open addressing table of slots and a pool
+   of records sorted by word.  A record is the UTF-8 word, then its
+   stem as the length of the prefix it shares with the word plus the
+   rest, every length a varint, so the usual stem costs two bytes more
+   than its word.  Nothing is parsed when a file is loaded, lookups
+   only read the image, so any number of threads and every process
+   mapping the same file share it without locks.
+
+   Licensed under GPLv3. See LICENCE.md file
+
+**/
+
+#ifndef STEMDICTIONARY_H
+#define STEMDICTIONARY_H
+
+#include <QByteArray>
+#include <QString>
+#include <QStringList>
+
+#include "imageformat.h"
+
+#define STEM_DICTIONARY_MAGIC    0x44535350u  /* "PSSD" read as little endian */
+#define STEM_DICTIONARY_VERSION  1
+#define STEM_DICTIONARY_FREE     0xffffffffu  /* record of an unused slot */
+
+typedef struct {
+           quint32 magic;          /* STEM_DICTIONARY_MAGIC */
+           quint32 version;        /* STEM_DICTIONARY_VERSION */
+           quint32 size;           /* bytes in the whole image */
+           char language[4];       /* "lv" or "en", NUL padded */
+           quint32 wordCount;
+           quint32 slots;          /* offset of the DictionarySlot array */
+           quint32 slotCount;      /* a power of two */
+           quint32 maxProbe;       /* longest probe sequence of any word */
+           quint32 pool;           /* offset of the records */
+           quint32 poolSize;
+           } DictionaryHeader;
+
+typedef struct {
+           quint32 hash;           /* hash() of the word */
+           quint32 record;         /* offset into the pool, or STEM_DICTIONARY_FREE */
+           } DictionarySlot;
+
+class StemDictionary
+{
+public:
+    typedef QString (*StemFunction)(QString);
+
+    explicit StemDictionary(StemFunction stemFunction = NULL);
+
+    bool load(const QString &fileName);
+    bool setImage(const QByteArray &image);
+    bool isValid() const { return NULL != header; }
+    QString errorString() const { return error; }
+    QString language() const;
+    int size() const;
+
+    // Looks the UTF-8 word[0..length) up as given, without lowering, and
+    // returns the byte length of its stem, or -1 if the word is not in
+    // the dictionary. Nothing is written past capacity; if the returned
+    // length is larger, call again with a bigger out buffer.
+    int find(const char *word, int length, char *out, int capacity) const;
+
+    // The stem from the dictionary, else from the stem function.
+    QString stem(const QString &word) const;
+
+    // Image holding stems[i] for every words[i], first one wins.
+    static QByteArray build(const QString &language, const QStringList &words, const QStringList &stems);
+
+    static quint32 hash(const char *word, int length);
+
+private:
+    Q_DISABLE_COPY(StemDictionary)
+
+    bool attach(const uchar *data, qint64 size);
+    bool fail(const QString &message);
+
+    StemFunction stemFunction;
+    MappedImage mapped;             /* of load() or setImage() */
+    QString error;
+
+    const DictionaryHeader *header; /* NULL until an image is attached */
+    const DictionarySlot *slots;
+    const uchar *pool;
+};
+
+#endif // STEMDICTIONARY_H
@@ -0,0 +1,312 @@
+/******************************************************************
+
+   Concurrent interner handing out a 32-bit id per distinct stem.
+
+   Licensed under GPLv3. See LICENCE.md file
+
+**/
+
+#include "steminterner.h"
+
+#include <QMutexLocker>
+#include <QVarLengthArray>
+
+#include <string.h>
+
+/*****************************************************************************/
+/*****************   Private Defines and Data Structures   *******************/
+
+/* Characters in one arena chunk, longer stems get a chunk of their own */
+#define INTERN_CHUNK  65536
+
+/* Slots of a new shard table; a table grows once it is half full */
+#define INTERN_FIRST_SLOTS  1024
+
+/*****************************************************************************/
+/********************   Private Function Declarations   **********************/
+static int BlockOf( quint32 id, quint32 *offset );
+
+
+/*FN**************************************************************************
+
+       BlockOf( id, offset )
+
+   Returns: int -- the directory block holding id, its index in the
+                   block in *offset
+
+   Notes:   Block b starts at id STEM_INTERNER_BLOCK * (2^b - 1), so b is
+            the highest set bit of id / STEM_INTERNER_BLOCK + 1.
+**/
+
+static int BlockOf( quint32 id, quint32 *offset )
+{
+    quint32 n = id / STEM_INTERNER_BLOCK + 1;
+    int block = 0;
+
+    for(int shift=16; shift>0; shift/=2)
+    {
+        if(n >> shift)
+        {
+            n >>= shift;
+            block += shift;
+        }
+    }
+
+    *offset = id - STEM_INTERNER_BLOCK * ((quint32(1) << block) - 1);
+    return block;
+} /* BlockOf */
+
+
+StemInterner::StemInterner(StemFunction stemFunction, int shardCount)
+    : stemFunction( stemFunction ), nextId( 0 )
+{
+    if(shardCount < 1)
+        shardCount = 1;
+
+    for(int i=0; i<shardCount; i++)
+    {
+        Shard *shard = new Shard;
+        Table *table = new Table;
+        table->mask = INTERN_FIRST_SLOTS - 1;
+        table->used = 0;
+        table->slots = new Slot[INTERN_FIRST_SLOTS];
+        shard->table.store( table );
+        shard->free = NULL;
+        shard->left = 0;
+        shards.append( shard );
+    }
+}
+
+StemInterner::~StemInterner()
+{
+    for(int i=0; i<shards.size(); i++)
+    {
+        Shard *shard = shards.at(i);
+        shard->retired.append( shard->table.load() );
+        for(int t=0; t<shard->retired.size(); t++)
+        {
+            delete[] shard->retired.at(t)->slots;
+            delete shard->retired.at(t);
+        }
+        for(int c=0; c<shard->chunks.size(); c++)
+            delete[] shard->chunks.at(c);
+        delete shard;
+    }
+
+    for(int b=0; b<STEM_INTERNER_BLOCKS; b++)
+        delete[] blocks[b].load();
+}
+
+quint32 StemInterner::hash(const QChar *text, int length)
+{
+    quint32 h = 2166136261u;
+
+    for(int i=0; i<length; i++)
+    {
+        h ^= text[i].unicode();
+        h *= 16777619u;
+    }
+
+    return h;
+} /* hash */
+
+const StemInterner::Entry &StemInterner::entry(quint32 id) const
+{
+    quint32 offset;
+    int block = BlockOf( id, &offset );
+
+    return blocks[block].loadAcquire()[offset];
+}
+
+
+/*FN**************************************************************************
+
+       lookup( shard, h, text, length )
+
+   Returns: quint32 -- id of the text, STEM_INTERNER_NONE if the shard
+                       does not have it
+
+   Purpose: Probe the shard's current table without locking.
+
+   Notes:   A slot's id is published with release after its hash and its
+            entry are written, so once a slot reads as used through an
+            acquire load both are complete.  A table that has just been
+            replaced is still whole, it only misses the newest stems,
+            and the caller looks again under the lock before adding.
+**/
+
+quint32 StemInterner::lookup(const Shard &shard, quint32 h, const QChar *text, int length) const
+{
+    const Table *table = shard.table.loadAcquire();
+
+    for(quint32 i=h & table->mask; ; i=(i + 1) & table->mask)
+    {
+        quint32 id = table->slots[i].id.loadAcquire();
+        if(0 == id)
+            return STEM_INTERNER_NONE;
+
+        if(table->slots[i].hash == h)
+        {
+            const Entry &e = entry( id - 1 );
+            if(e.length == length && 0 == memcmp( e.text, text, length * sizeof(QChar) ))
+                return id - 1;
+        }
+    }
+} /* lookup */
+
+quint32 StemInterner::find(const QChar *text, int length) const
+{
+    quint32 h = hash( text, length );
+    const Shard &shard = *shards.at( int((quint64(h) * shards.size()) >> 32) );
+
+    return lookup( shard, h, text, length );
+}
+
+quint32 StemInterner::intern(const QChar *text, int length)
+{
+    quint32 h = hash( text, length );
+    Shard &shard = *shards.at( int((quint64(h) * shards.size()) >> 32) );
+
+    quint32 id = lookup( shard, h, text, length );
+    if(STEM_INTERNER_NONE != id)
+        return id;
+
+    QMutexLocker locker( &shard.lock );
+    id = lookup( shard, h, text, length );
+    if(STEM_INTERNER_NONE != id)
+        return id;
+
+    return add( shard, h, text, length );
+}
+
+
+/*FN**************************************************************************
+
+       add( shard, h, text, length )
+
+   Returns: quint32 -- the new id, STEM_INTERNER_NONE if every id is used
+
+   Purpose: Store a stem the locked shard does not have yet.
+
+   Plan:    Copy the text into the arena, take the next id, fill its
+            directory entry, and only then publish the id in a slot.  A
+            half full table is first copied into one twice the size,
+            which is published whole; the old table is kept, a reader
+            may still be probing it.
+**/
+
+quint32 StemInterner::add(Shard &shard, quint32 h, const QChar *text, int length)
+{
+    quint32 id = nextId.fetchAndAddRelaxed( 1 );
+    quint32 offset;
+    int block = BlockOf( id, &offset );
+    if(block >= STEM_INTERNER_BLOCKS)
+        return STEM_INTERNER_NONE;
+
+    Entry *entries = blocks[block].loadAcquire();
+    if(NULL == entries)
+    {
+        QMutexLocker locker( &blockLock );
+        entries = blocks[block].loadAcquire();
+        if(NULL == entries)
+        {
+            entries = new Entry[STEM_INTERNER_BLOCK << block];
+            blocks[block].storeRelease( entries );
+        }
+    }
+
+    entries[offset].text = store( shard, text, length );
+    entries[offset].length = length;
+
+    Table *table = shard.table.load();
+    if(2 * (table->used + 1) > int(table->mask + 1))
+    {
+        Table *grown = new Table;
+        grown->mask = 2 * table->mask + 1;
+        grown->used = table->used;
+        grown->slots = new Slot[grown->mask + 1];
+        for(quint32 i=0; i<=table->mask; i++)
+        {
+            quint32 old = table->slots[i].id.load();
+            if(0 != old)
+                place( grown, table->slots[i].hash, old );
+        }
+        shard.retired.append( table );
+        shard.table.storeRelease( grown );
+        table = grown;
+    }
+
+    place( table, h, id + 1 );
+    table->used++;
+
+    return id;
+} /* add */
+
+void StemInterner::place(Table *table, quint32 h, quint32 id)
+{
+    quint32 i = h & table->mask;
+    while(0 != table->slots[i].id.load())
+        i = (i + 1) & table->mask;
+
+    table->slots[i].hash = h;
+    table->slots[i].id.storeRelease( id );
+}
+
+const QChar *StemInterner::store(Shard &shard, const QChar *text, int length)
+{
+    QChar *copy;
+
+    if(length > INTERN_CHUNK / 4)
+    {
+        copy = new QChar[length];
+        shard.chunks.append( copy );
+    }
+    else
+    {
+        if(length > shard.left)
+        {
+            shard.free = new QChar[INTERN_CHUNK];
+            shard.left = INTERN_CHUNK;
+            shard.chunks.append( shard.free );
+        }
+        copy = shard.free;
+        shard.free += length;
+        shard.left -= length;
+    }
+
+    memcpy( copy, text, length * sizeof(QChar) );
+    return copy;
+}
+
+
+/*FN**************************************************************************
+
+       stem( word, length )
+
+   Returns: quint32 -- id of the stem of word
+
+   Purpose: Stem a copy of the word on the stack and intern the result,
+            so the stem never becomes a QString.
+**/
+
+quint32 StemInterner::stem(const QChar *word, int length)
+{
+    QVarLengthArray<QChar, 64> buffer( length );
+    memcpy( buffer.data(), word, length * sizeof(QChar) );
+
+    int size = NULL == stemFunction ? length : stemFunction( buffer.data(), length );
+    return intern( buffer.constData(), size );
+}
+
+const QChar *StemInterner::text(quint32 id, int *length) const
+{
+    const Entry &e = entry( id );
+    *length = e.length;
+    return e.text;
+}
+
+QString StemInterner::string(quint32 id) const
+{
+    const Entry &e = entry( id );
+    return QString( e.text, e.length );
+}
@@ -0,0 +1,100 @@
+/******************************************************************
+
+   Concurrent interner handing out a 32-bit id per distinct stem.
+
+   Stems are copied once into arenas that never move and numbered
+   from 0.  Looking a stem up or reading the text of an id takes no
+   lock; only adding a new stem locks, and only the one shard its hash
+   falls in.
+
+   Licensed under GPLv3. See LICENCE.md file
+
+**/
+
+#ifndef STEMINTERNER_H
+#define STEMINTERNER_H
+
+#include <QAtomicInteger>
+#include <QAtomicPointer>
+#include <QMutex>
+#include <QString>
+#include <QVector>
+
+#define STEM_INTERNER_NONE   0xffffffffu  /* find() of a stem not interned */
+
+/* Ids live in blocks of 2^b * STEM_INTERNER_BLOCK entries for block b,
+   so the directory stays fixed and entries never move */
+#define STEM_INTERNER_BLOCK  1024
+#define STEM_INTERNER_BLOCKS 22
+
+class StemInterner
+{
+public:
+    // Stems word[0..length) in place and returns the stem length; the
+    // stem(QChar *, int) overloads of both stemmers fit.
+    typedef int (*StemFunction)(QChar *word, int length);
+
+    explicit StemInterner(StemFunction stemFunction = NULL, int shardCount = 16);
+    ~StemInterner();
+
+    // Id of the text, adding it the first time it is seen.
+    quint32 intern(const QChar *text, int length);
+    quint32 intern(const QString &text) { return intern( text.constData(), text.length() ); }
+
+    // Id of the text, STEM_INTERNER_NONE if it was never interned.
+    quint32 find(const QChar *text, int length) const;
+
+    // Id of the stem of word; the word itself is left alone.
+    quint32 stem(const QChar *word, int length);
+    quint32 stem(const QString &word) { return stem( word.constData(), word.length() ); }
+
+    // Text of an id this interner returned, valid for its lifetime.
+    const QChar *text(quint32 id, int *length) const;
+    QString string(quint32 id) const;
+
+    // Ids handed out so far, ids are 0 .. size() - 1.
+    quint32 size() const { return nextId.load(); }
+
+private:
+    Q_DISABLE_COPY(StemInterner)
+
+    typedef struct {
+               const QChar *text;      /* in a shard arena */
+               int length;
+               } Entry;
+
+    typedef struct {
+               QAtomicInteger<quint32> id;  /* id + 1, 0 for a free slot */
+               quint32 hash;           /* written before id is published */
+               } Slot;
+
+    typedef struct {
+               quint32 mask;           /* slots - 1, slots a power of two */
+               int used;
+               Slot *slots;
+               } Table;
+
+    typedef struct {
+               QMutex lock;            /* serializes adding stems */
+               QAtomicPointer<Table> table;
+               QVector<Table *> retired;   /* outgrown tables, readers may still probe them */
+               QVector<QChar *> chunks;    /* arena, never moved or freed early */
+               QChar *free;            /* unused end of the last chunk */
+               int left;
+               } Shard;
+
+    static quint32 hash(const QChar *text, int length);
+    const Entry &entry(quint32 id) const;
+    quint32 lookup(const Shard &shard, quint32 h, const QChar *text, int length) const;
+    quint32 add(Shard &shard, quint32 h, const QChar *text, int length);
+    const QChar *store(Shard &shard, const QChar *text, int length);
+    static void place(Table *table, quint32 h, quint32 id);
+
+    StemFunction stemFunction;
+    QVector<Shard *> shards;
+    QAtomicInteger<quint32> nextId;
+    QMutex blockLock;              /* serializes allocating blocks */
+    QAtomicPointer<Entry> blocks[STEM_INTERNER_BLOCKS];
+};
+
+#endif // STEMINTERNER_H
@@ -0,0 +1,54 @@
+#-------------------------------------------------
+#
+# Stemmer library sources, shared by every target
+#
+#-------------------------------------------------
+
+QT       += concurrent
+
+INCLUDEPATH += $$PWD
+
+# qmake CONFIG+=stemmer_rule_stats counts how often each rule fires
+stemmer_rule_stats: DEFINES += STEMMER_RULE_STATS
+
+# The rule tables hold u"" literals written in UTF-8
+win32-msvc*: QMAKE_CXXFLAGS += /utf-8
+
+SOURCES += $$PWD/enporterstemmer.cpp \
+    $$PWD/imageformat.cpp \
+    $$PWD/indexsegment.cpp \
+    $$PWD/invertedindex.cpp \
+    $$PWD/lvporterstemmer.cpp \
+    $$PWD/lowercase.cpp \
+    $$PWD/ruleautomaton.cpp \
+    $$PWD/rulecompiler.cpp \
+    $$PWD/rulestats.cpp \
+    $$PWD/stemcache.cpp \
+    $$PWD/stemdictionary.cpp \
+    $$PWD/steminterner.cpp \
+    $$PWD/suffixtrie.cpp \
+    $$PWD/termfrequency.cpp \
+    $$PWD/textanalyzer.cpp \
+    $$PWD/utf8text.cpp \
+    $$PWD/wordset.cpp
+
+HEADERS  += $$PWD/enporterstemmer.h \
+    $$PWD/imageformat.h \
+    $$PWD/indexsegment.h \
+    $$PWD/invertedindex.h \
+    $$PWD/lvporterstemmer.h \
+    $$PWD/lowercase.h \
+    $$PWD/porterengine.h \
+    $$PWD/ruleautomaton.h \
+    $$PWD/rulecompiler.h \
+    $$PWD/rulestats.h \
+    $$PWD/ruletext.h \
+    $$PWD/stembatch.h \
+    $$PWD/stemcache.h \
+    $$PWD/stemdictionary.h \
+    $$PWD/steminterner.h \
+    $$PWD/suffixtrie.h \
+    $$PWD/termfrequency.h \
+    $$PWD/textanalyzer.h \
+    $$PWD/utf8text.h \
+    $$PWD/wordset.h
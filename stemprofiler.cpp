@@ -0,0 +1,326 @@
+/******************************************************************
+
+   Replays a word list through one stemmer on a pool thread and keeps
+   running figures of its cost.
+
+   Licensed under GPLv3. See LICENCE.md file
+
+**/
+
+#include "stemprofiler.h"
+#include "enporterstemmer.h"
+#include "lvporterstemmer.h"
+
+#ifdef PROFILE_ALLOCATIONS
+#  include "bench/allocationcount.h"
+#else
+#  define AllocationCount() quint64(0)
+#endif
+
+#include <QElapsedTimer>
+#include <QMutexLocker>
+#include <QtConcurrent>
+
+#include <string.h>
+
+/*****************************************************************************/
+/*****************   Private Defines and Data Structures   *******************/
+
+/* Least time between two updated() signals */
+#define PROFILE_UPDATE_MS  200
+
+/* Words between two looks at stopRequested */
+#define PROFILE_CHECK_WORDS  1024
+
+/* Pass modes below 0 for timePrefix(), 0.. is the number of steps */
+#define PASS_COPY  -1              /* only copy the words, the baseline */
+
+/* Keeps the compiler from dropping the stemming as dead code */
+static volatile quint64 sink;
+
+const StemProfiler::Stemmer StemProfiler::stemmers[] =
+           {
+             {"en", ENPorterStemmer::stem, ENPorterStemmer::stemSteps,
+              ENPorterStemmer::stepCount, ENPorterStemmer::stepName},
+             {"lv", LVPorterStemmer::stem, LVPorterStemmer::stemSteps,
+              LVPorterStemmer::stepCount, LVPorterStemmer::stepName},
+           };
+
+/*****************************************************************************/
+/********************   Private Function Declarations   **********************/
+static int LatencyBucket( qint64 nsecs );
+static qint64 BucketValue( int bucket );
+static qint64 Percentile( const QVector<quint64> &histogram, quint64 total, double fraction );
+
+
+/*FN**************************************************************************
+
+       LatencyBucket( nsecs )
+
+   Returns: int -- histogram bucket of a latency
+
+   Notes:   Below 16 ns every nanosecond has a bucket, above that each
+            power of two is split in 8, so a bucket is within 12.5%.
+**/
+
+static int LatencyBucket( qint64 nsecs )
+{
+    if(nsecs < 16)
+        return nsecs < 0 ? 0 : int(nsecs);
+
+    int octave = 4;
+    while(octave < 62 && (nsecs >> (octave + 1)))
+        octave++;
+
+    int bucket = 16 + (octave - 4) * 8 + int((nsecs >> (octave - 3)) & 7);
+    return qMin( bucket, PROFILE_LATENCY_BUCKETS - 1 );
+} /* LatencyBucket */
+
+static qint64 BucketValue( int bucket )
+{
+    if(bucket < 16)
+        return bucket;
+
+    int octave = (bucket - 16) / 8 + 4;
+    qint64 low = qint64(8 + (bucket - 16) % 8) << (octave - 3);
+
+    return low + (qint64(1) << (octave - 3)) / 2;
+} /* BucketValue */
+
+static qint64 Percentile( const QVector<quint64> &histogram, quint64 total, double fraction )
+{
+    quint64 rank = quint64(fraction * total);
+    quint64 seen = 0;
+
+    if(0 == total)
+        return -1;
+
+    for(int i=0; i<histogram.size(); i++)
+    {
+        seen += histogram.at(i);
+        if(seen > rank)
+            return BucketValue( i );
+    }
+
+    return BucketValue( histogram.size() - 1 );
+} /* Percentile */
+
+
+StemProfiler::StemProfiler(QObject *parent) :
+    QObject(parent),
+    stemmer(NULL),
+    passes(0)
+{
+    connect(&watcher, SIGNAL(finished()), this, SIGNAL(finished()));
+}
+
+StemProfiler::~StemProfiler()
+{
+    stop();
+    watcher.waitForFinished();
+}
+
+
+/*FN**************************************************************************
+
+       start( language, words, passes )
+
+   Returns: bool -- false if a run is going, there are no words or the
+                    language is unknown
+
+   Purpose: Lay the words out the way the benchmark does and start the
+            replay on the global thread pool.
+**/
+
+bool StemProfiler::start(const QString &language, const QVector<QString> &words, int passes)
+{
+    if(isRunning() || words.isEmpty())
+        return false;
+
+    stemmer = NULL;
+    for(int i=0; i<int(sizeof(stemmers) / sizeof(stemmers[0])); i++)
+    {
+        if(language == stemmers[i].language)
+            stemmer = &stemmers[i];
+    }
+    if(NULL == stemmer)
+        return false;
+
+    steps = QStringList() << "lower";
+    for(int i=0; i<stemmer->stepCount(); i++)
+        steps << stemmer->stepName( i );
+
+    this->words = words;
+    this->passes = qMax( 1, passes );
+    text.clear();
+    offsets.clear();
+    offsets.append( 0 );
+    int longest = 0;
+    for(int i=0; i<words.size(); i++)
+    {
+        for(int j=0; j<words.at(i).length(); j++)
+            text.append( words.at(i).at(j) );
+        offsets.append( text.size() );
+        longest = qMax( longest, words.at(i).length() );
+    }
+    scratch.resize( longest + 1 );
+
+    ProfileSnapshot empty = { 0, 0, 0, 0, -1, -1, QVector<double>() };
+    lock.lock();
+    current = empty;
+    lock.unlock();
+
+    stopRequested.store( 0 );
+    watcher.setFuture( QtConcurrent::run( this, &StemProfiler::run ) );
+
+    return true;
+}
+
+void StemProfiler::stop()
+{
+    stopRequested.store( 1 );
+}
+
+ProfileSnapshot StemProfiler::snapshot() const
+{
+    QMutexLocker locker( &lock );
+    return current;
+}
+
+
+/*FN**************************************************************************
+
+       run()
+
+   Purpose: The replay, on a pool thread.
+
+   Plan:    Each pass times the word copy alone, stemSteps() with 0, 1,
+            ... stepCount() steps, and then stem(QString) one word at
+            a time.  A step costs the difference between two
+            neighbouring prefixes, as in the benchmark, and the
+            averages over the passes so far are published after each
+            pass.  Throughput, latency and allocations are those of
+            stem(QString), which is what callers pay; its latencies
+            include reading the clock, some tens of ns.
+**/
+
+void StemProfiler::run()
+{
+    int count = stemmer->stepCount();
+    QVector<qint64> prefixNs( count + 2, 0 );      /* [0] the copy, [k + 1] k steps */
+    QVector<int> prefixPasses( count + 2, 0 );
+    QVector<quint64> histogram( PROFILE_LATENCY_BUCKETS, 0 );
+    QVector<quint64> passHistogram( PROFILE_LATENCY_BUCKETS );
+    ProfileSnapshot totals = { 0, 0, 0, 0, -1, -1, QVector<double>() };
+    QElapsedTimer sinceUpdate;
+
+    sinceUpdate.start();
+    for(int pass=0; pass<passes; pass++)
+    {
+        qint64 nsecs;
+        int mode = PASS_COPY;
+        while(mode <= count && timePrefix( mode, &nsecs ))
+        {
+            prefixNs[mode + 1] += nsecs;
+            prefixPasses[mode + 1]++;
+            mode++;
+        }
+
+        quint64 allocations;
+        passHistogram.fill( 0 );
+        if(mode <= count || !timeStrings( passHistogram, &nsecs, &allocations ))
+            break;
+        for(int i=0; i<histogram.size(); i++)
+            histogram[i] += passHistogram.at(i);
+
+        totals.passes++;
+        totals.words += words.size();
+        totals.nsecs += nsecs;
+        totals.allocations += allocations;
+
+        if(sinceUpdate.elapsed() >= PROFILE_UPDATE_MS)
+        {
+            publish( totals, histogram, prefixNs, prefixPasses );
+            sinceUpdate.restart();
+            emit updated();
+        }
+    }
+
+    publish( totals, histogram, prefixNs, prefixPasses );
+    emit updated();
+} /* run */
+
+
+/*FN**************************************************************************
+
+       timePrefix( steps, nsecs )
+
+   Returns: bool -- false if stopped before the end of the list
+
+   Purpose: Time one pass of copying each word into scratch and, unless
+            steps is PASS_COPY, running the first steps on it.
+**/
+
+bool StemProfiler::timePrefix(int steps, qint64 *nsecs)
+{
+    quint64 checksum = 0;
+    QElapsedTimer timer;
+
+    timer.start();
+    for(int i=0; i<words.size(); i++)
+    {
+        if(0 == i % PROFILE_CHECK_WORDS && stopRequested.load())
+            return false;
+
+        int length = offsets.at(i + 1) - offsets.at(i);
+        memcpy( scratch.data(), text.constData() + offsets.at(i), length * sizeof(QChar) );
+        if(PASS_COPY != steps)
+            length = stemmer->stemSteps( scratch.data(), length, steps );
+        checksum += length + (length > 0 ? scratch.at(length - 1).unicode() : 0);
+    }
+    *nsecs = timer.nsecsElapsed();
+    sink += checksum;
+
+    return true;
+}
+
+bool StemProfiler::timeStrings(QVector<quint64> &histogram, qint64 *nsecs, quint64 *allocations)
+{
+    quint64 checksum = 0;
+    quint64 before = AllocationCount();
+    QElapsedTimer timer;
+
+    timer.start();
+    qint64 previous = 0;
+    for(int i=0; i<words.size(); i++)
+    {
+        if(0 == i % PROFILE_CHECK_WORDS && stopRequested.load())
+            return false;
+
+        checksum += stemmer->stemString( words.at(i) ).length();
+        qint64 now = timer.nsecsElapsed();
+        histogram[LatencyBucket( now - previous )]++;
+        previous = now;
+    }
+    *nsecs = timer.nsecsElapsed();
+    *allocations = AllocationCount() - before;
+    sink += checksum;
+
+    return true;
+}
+
+void StemProfiler::publish(const ProfileSnapshot &totals, const QVector<quint64> &histogram,
+                           const QVector<qint64> &prefixNs, const QVector<int> &prefixPasses)
+{
+    ProfileSnapshot next = totals;
+    double n = words.size();
+
+    next.p50 = Percentile( histogram, totals.words, 0.50 );
+    next.p99 = Percentile( histogram, totals.words, 0.99 );
+    for(int step=0; totals.passes>0 && step+1<prefixNs.size(); step++)
+        next.stepNs.append( prefixNs.at(step + 1) / (prefixPasses.at(step + 1) * n)
+                            - prefixNs.at(step) / (prefixPasses.at(step) * n) );
+
+    QMutexLocker locker( &lock );
+    current = next;
+}
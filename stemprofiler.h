@@ -0,0 +1,97 @@
+/******************************************************************
+
+   Replays a word list through one stemmer on a pool thread and keeps
+   running figures of its cost: throughput, per word latency
+   percentiles, allocations and the time of each step.
+
+   Licensed under GPLv3. See LICENCE.md file
+
+**/
+
+#ifndef STEMPROFILER_H
+#define STEMPROFILER_H
+
+#include <QAtomicInteger>
+#include <QFutureWatcher>
+#include <QMutex>
+#include <QObject>
+#include <QString>
+#include <QStringList>
+#include <QVector>
+
+/* Latency histogram: 1 ns buckets below 16 ns, then 8 per power of two */
+#define PROFILE_LATENCY_BUCKETS  512
+
+typedef struct {
+           int passes;                 /* whole passes over the list so far */
+           quint64 words;              /* words through stem(QString) */
+           qint64 nsecs;               /* time those words took */
+           quint64 allocations;        /* heap allocations during those words, 0
+                                          without CONFIG+=profile_allocations */
+           qint64 p50;                 /* ns per word, median */
+           qint64 p99;
+           QVector<double> stepNs;     /* ns per word of each step, empty before the first pass */
+           } ProfileSnapshot;
+
+class StemProfiler : public QObject
+{
+    Q_OBJECT
+
+public:
+    explicit StemProfiler(QObject *parent = 0);
+    ~StemProfiler();
+
+    // Starts replaying words through the "lv" or "en" stemmer, passes
+    // times over. False if a run is going, there are no words or the
+    // language is unknown.
+    bool start(const QString &language, const QVector<QString> &words, int passes);
+    bool isRunning() const { return watcher.isRunning(); }
+
+    // Names of the steps of the running stemmer, "lower" first.
+    QStringList stepNames() const { return steps; }
+
+    // Figures as of the last finished pass, safe to call while running.
+    ProfileSnapshot snapshot() const;
+
+public slots:
+    // Stops at the next checkpoint; the unfinished pass is not counted.
+    void stop();
+
+signals:
+    // At most every PROFILE_UPDATE_MS while running.
+    void updated();
+    void finished();
+
+private:
+    typedef struct {
+               const char *language;
+               QString (*stemString)(QString word);
+               int (*stemSteps)(QChar *word, int length, int steps);
+               int (*stepCount)();
+               const char *(*stepName)(int step);
+               } Stemmer;
+
+    void run();
+    bool timePrefix(int steps, qint64 *nsecs);
+    bool timeStrings(QVector<quint64> &histogram, qint64 *nsecs, quint64 *allocations);
+    void publish(const ProfileSnapshot &totals, const QVector<quint64> &histogram,
+                 const QVector<qint64> &prefixNs, const QVector<int> &prefixPasses);
+
+    static const Stemmer stemmers[];
+
+    QFutureWatcher<void> watcher;
+    QAtomicInteger<int> stopRequested;
+    const Stemmer *stemmer;
+    QStringList steps;
+    int passes;
+
+    QVector<QString> words;        /* input of the run */
+    QVector<QChar> text;           /* the words back to back */
+    QVector<int> offsets;          /* word i is text[offsets[i]..offsets[i+1]) */
+    QVector<QChar> scratch;
+
+    mutable QMutex lock;           /* guards current */
+    ProfileSnapshot current;
+};
+
+#endif // STEMPROFILER_H
@@ -0,0 +1,117 @@
+/******************************************************************
+
+   Reversed-suffix trie used to look up the candidate rules of a
+   stemming step with one backward walk over the word.
+
+   Licensed under GPLv3. See LICENCE.md file
+
+**/
+
+#include "suffixtrie.h"
+
+SuffixTrie::SuffixTrie()
+{
+    Node root = { 0, -1, -1, -1 };
+    nodes.append( root );
+}
+
+/*FN**************************************************************************
+
+       addSuffix( suffix, length, rule )
+
+   Purpose: Register rule index rule as matching words ending in suffix.
+
+   Plan:    Walk the suffix from its last character to its first,
+            creating nodes as needed, and chain the rule onto the node
+            where the walk stops.  The empty suffix lands on the root.
+
+   Notes:   Rule indices must be smaller than SUFFIX_TRIE_MAX_RULES.
+**/
+
+void SuffixTrie::addSuffix(const QChar *suffix, int length, int rule)
+{
+    Q_ASSERT( rule >= 0 && rule < SUFFIX_TRIE_MAX_RULES );
+
+    int node = 0;
+    for(int i=length-1; i>=0; i--)
+    {
+        ushort ch = suffix[i].unicode();
+        int child = nodes.at(node).child;
+        while ( -1 != child && nodes.at(child).ch != ch )
+            child = nodes.at(child).sibling;
+
+        if ( -1 == child )
+        {
+            Node added = { ch, -1, nodes.at(node).child, -1 };
+            child = nodes.size();
+            nodes.append( added );
+            nodes[node].child = child;
+        }
+        node = child;
+    }
+
+    if ( nextRule.size() <= rule )
+        nextRule.resize( rule + 1 );
+    nextRule[rule] = nodes.at(node).rule;
+    nodes[node].rule = rule;
+} /* addSuffix */
+
+void SuffixTrie::addSuffix(const QString &suffix, int rule)
+{
+    addSuffix( suffix.constData(), suffix.length(), rule );
+}
+
+
+/*FN**************************************************************************
+
+       match( word, length, rules )
+
+   Returns: int -- the number of rule indices written to rules
+
+   Purpose: Find every registered suffix the word ends with.
+
+   Plan:    Walk backwards from the last character of the word, collecting
+            the rules chained on each node passed, then sort them so the
+            caller sees them in their original table order.
+
+   Notes:   rules must have room for SUFFIX_TRIE_MAX_RULES entries.
+**/
+
+int SuffixTrie::match(const QChar *word, int length, int *rules) const
+{
+    int count = 0;
+    int node = 0;
+    int i = length;
+
+    for(;;)
+    {
+        for(int rule=nodes.at(node).rule; -1 != rule; rule=nextRule.at(rule))
+            rules[count++] = rule;
+
+        if ( 0 == i )
+            break;
+
+        ushort ch = word[--i].unicode();
+        node = nodes.at(node).child;
+        while ( -1 != node && nodes.at(node).ch != ch )
+            node = nodes.at(node).sibling;
+
+        if ( -1 == node )
+            break;
+    }
+
+                /* Insertion sort, there are only ever a handful of matches */
+    for(int j=1; j<count; j++)
+    {
+        int rule = rules[j];
+        int k = j;
+        while ( k > 0 && rules[k-1] > rule )
+        {
+            rules[k] = rules[k-1];
+            k--;
+        }
+        rules[k] = rule;
+    }
+
+    return( count );
+} /* match */
@@ -0,0 +1,40 @@
+/******************************************************************
+
+   Reversed-suffix trie used to look up the candidate rules of a
+   stemming step with one backward walk over the word.
+
+   Licensed under GPLv3. See LICENCE.md file
+
+**/
+
+#ifndef SUFFIXTRIE_H
+#define SUFFIXTRIE_H
+
+#include <QString>
+#include <QVector>
+
+/* Upper bound on the number of rules in one step table */
+#define SUFFIX_TRIE_MAX_RULES 64
+
+class SuffixTrie
+{
+public:
+    SuffixTrie();
+
+    void addSuffix(const QString &suffix, int rule);
+    void addSuffix(const QChar *suffix, int length, int rule);
+    int match(const QChar *word, int length, int *rules) const;
+
+private:
+    typedef struct {
+               ushort ch;         /* character on the edge into this node */
+               int child;         /* first child, -1 if none */
+               int sibling;       /* next sibling, -1 if none */
+               int rule;          /* first rule ending here, -1 if none */
+               } Node;
+
+    QVector<Node> nodes;
+    QVector<int> nextRule;        /* next rule sharing the same node */
+};
+
+#endif // SUFFIXTRIE_H
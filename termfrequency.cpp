@@ -0,0 +1,237 @@
+/******************************************************************
+
+   Tokenize -> stem -> count pipeline over memory mapped files.
+
+   Licensed under GPLv3. See LICENCE.md file
+
+**/
+
+#include "termfrequency.h"
+#include "utf8text.h"
+
+#include <QFile>
+#include <QThread>
+#include <QVarLengthArray>
+#include <QtConcurrent>
+
+#include <algorithm>
+#include <string.h>
+
+/*****************************************************************************/
+/*****************   Private Defines and Data Structures   *******************/
+
+/* Stem counts of one slice, probed with the stem buffer itself so a
+   token only costs a QString when its stem is seen for the first time */
+class SliceCounts
+{
+public:
+    SliceCounts() : used(0) { stems.resize( 1024 ); counts.resize( 1024 ); }
+
+    void add(const QChar *stem, int length)
+    {
+        if(2 * (used + 1) > stems.size())
+            grow();
+
+        int i = find( stem, length );
+        if(stems.at(i).isEmpty())
+        {
+            stems[i] = QString( stem, length );
+            used++;
+        }
+        counts[i]++;
+    }
+
+    QVector<QString> stems;        /* empty string marks a free slot */
+    QVector<quint64> counts;
+
+private:
+    int find(const QChar *stem, int length) const
+    {
+        uint h = 2166136261u;
+        for(int i=0; i<length; i++)
+            h = (h ^ stem[i].unicode()) * 16777619u;
+
+        int mask = stems.size() - 1;
+        int i = h & mask;
+        while(!stems.at(i).isEmpty()
+              && !(stems.at(i).length() == length && 0 == memcmp( stems.at(i).constData(), stem, length * sizeof(QChar) )))
+            i = (i + 1) & mask;
+        return i;
+    }
+
+    void grow()
+    {
+        QVector<QString> oldStems = stems;
+        QVector<quint64> oldCounts = counts;
+
+        stems = QVector<QString>( 2 * oldStems.size() );
+        counts = QVector<quint64>( 2 * oldStems.size(), 0 );
+        for(int j=0; j<oldStems.size(); j++)
+        {
+            if(oldStems.at(j).isEmpty())
+                continue;
+            int i = find( oldStems.at(j).constData(), oldStems.at(j).length() );
+            stems[i] = oldStems.at(j);
+            counts[i] = oldCounts.at(j);
+        }
+    }
+
+    int used;
+};
+
+typedef struct {
+           const char *text;
+           qint64 begin;                          /* slice of text to count */
+           qint64 end;
+           TermFrequency::StemFunction stemFunction;
+           quint64 tokens;
+           SliceCounts counts;
+           } TermSlice;
+
+
+/*****************************************************************************/
+/********************   Private Function Declarations   **********************/
+
+static void CountSlice(TermSlice &slice)
+{
+    QVarLengthArray<QChar, 128> word;
+    qint64 pos = slice.begin;
+    qint64 start;
+
+    slice.tokens = 0;
+    while(Utf8NextToken( slice.text, slice.end, &pos, &start ))
+    {
+        int bytes = int(pos - start);
+        word.resize( bytes );
+        int length = Utf8ToUtf16( slice.text + start, bytes, word.data() );
+        length = slice.stemFunction( word.data(), length );
+
+        slice.tokens++;
+        if(length > 0)                    /* stop words stem to nothing */
+            slice.counts.add( word.constData(), length );
+    }
+}
+
+static bool ByCount(const TermCount &a, const TermCount &b)
+{
+    if(a.count != b.count)
+        return a.count > b.count;
+    return a.stem < b.stem;
+}
+
+
+TermFrequency::TermFrequency(StemFunction stemFunction, int threads) :
+    stemFunction(stemFunction),
+    threads(threads > 0 ? threads : QThread::idealThreadCount()),
+    tokenCount(0)
+{
+    if(this->threads <= 0)
+        this->threads = 1;
+}
+
+/*FN**************************************************************************
+
+       addFile( fileName )
+
+   Returns: bool -- false if the file could not be opened or mapped
+
+   Purpose: Count the stems of every token in a file without reading it
+            into memory.
+**/
+
+bool TermFrequency::addFile(const QString &fileName)
+{
+    QFile file( fileName );
+
+    if(!file.open( QIODevice::ReadOnly ))
+    {
+        error = fileName + ": " + file.errorString();
+        return false;
+    }
+
+    if(0 == file.size())
+        return true;
+
+    uchar *text = file.map( 0, file.size() );
+    if(!text)
+    {
+        error = fileName + ": " + file.errorString();
+        return false;
+    }
+
+    addText( reinterpret_cast<const char *>( text ), file.size() );
+    file.unmap( text );
+
+    return true;
+} /* addFile */
+
+
+/*FN**************************************************************************
+
+       addText( text, length )
+
+   Purpose: Count the stems of every token in text[0..length).
+
+   Plan:    Cut the text into one slice per thread at token boundaries,
+            count each slice into its own table on the thread pool, then
+            merge the slice tables into the running totals.
+**/
+
+void TermFrequency::addText(const char *text, qint64 length)
+{
+    QVector<TermSlice> slices( threads );
+    qint64 begin = 0;
+
+    for(int i=0; i<threads; i++)
+    {
+        qint64 end = (i == threads - 1) ? length : begin + (length - begin) / (threads - i);
+        end = Utf8TokenBoundary( text, length, end );
+        slices[i].text = text;
+        slices[i].begin = begin;
+        slices[i].end = end;
+        slices[i].stemFunction = stemFunction;
+        begin = end;
+    }
+
+    if(threads > 1)
+        QtConcurrent::blockingMap( slices, CountSlice );
+    else
+        CountSlice( slices[0] );
+
+    for(int i=0; i<slices.size(); i++)
+    {
+        const SliceCounts &counts = slices.at(i).counts;
+        for(int j=0; j<counts.stems.size(); j++)
+        {
+            if(!counts.stems.at(j).isEmpty())
+                this->counts[counts.stems.at(j)] += counts.counts.at(j);
+        }
+        tokenCount += slices.at(i).tokens;
+    }
+} /* addText */
+
+
+/*FN**************************************************************************
+
+       table()
+
+   Returns: QVector<TermCount> -- every stem seen, most frequent first and
+            alphabetical among equal counts
+**/
+
+QVector<TermCount> TermFrequency::table() const
+{
+    QVector<TermCount> table;
+    table.reserve( counts.size() );
+
+    for(QHash<QString, quint64>::const_iterator it=counts.constBegin(); it!=counts.constEnd(); ++it)
+    {
+        TermCount term;
+        term.stem = it.key();
+        term.count = it.value();
+        table.append( term );
+    }
+
+    std::sort( table.begin(), table.end(), ByCount );
+    return table;
+} /* table */
@@ -0,0 +1,43 @@
+/******************************************************************
+
+   Tokenize -> stem -> count pipeline over memory mapped files.
+
+   Licensed under GPLv3. See LICENCE.md file
+
+**/
+
+#ifndef TERMFREQUENCY_H
+#define TERMFREQUENCY_H
+
+#include <QHash>
+#include <QString>
+#include <QVector>
+
+typedef struct {
+           QString stem;
+           quint64 count;
+           } TermCount;
+
+class TermFrequency
+{
+public:
+    typedef int (*StemFunction)(QChar *word, int length);
+
+    explicit TermFrequency(StemFunction stemFunction, int threads = 0);
+
+    bool addFile(const QString &fileName);
+    void addText(const char *text, qint64 length);
+
+    QVector<TermCount> table() const;
+    quint64 tokens() const { return tokenCount; }
+    QString errorString() const { return error; }
+
+private:
+    StemFunction stemFunction;
+    int threads;
+    QHash<QString, quint64> counts;    /* merged over everything added */
+    quint64 tokenCount;
+    QString error;
+};
+
+#endif // TERMFREQUENCY_H
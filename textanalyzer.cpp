@@ -0,0 +1,114 @@
+/******************************************************************
+
+   Fused tokenizer and stemmer: one pass over a UTF-16 text buffer
+   yields every letter run with its position and its stem.
+
+   Licensed under GPLv3. See LICENCE.md file
+
+**/
+
+#include "textanalyzer.h"
+#include "utf8text.h"
+
+#include <string.h>
+
+/*****************************************************************************/
+/********************   Private Function Declarations   **********************/
+static int TokenCharAt( const QChar *text, int length, int pos, bool inToken );
+
+
+/*FN**************************************************************************
+
+       TokenCharAt( text, length, pos, inToken )
+
+   Returns: int -- code units of the character at pos if it belongs to
+                   a token, 0 if it does not
+
+   Purpose: Classify one character for the tokenizer by IsTokenChar(),
+            the same test the UTF-8 tokenizer makes.
+
+   Notes:   A surrogate pair is classified as the character it encodes,
+            a lone surrogate is a separator.
+**/
+
+static int TokenCharAt( const QChar *text, int length, int pos, bool inToken )
+{
+    uint c = text[pos].unicode();
+    int size = 1;
+
+    if ( text[pos].isHighSurrogate() )
+    {
+        if ( pos + 1 >= length || !text[pos+1].isLowSurrogate() )
+            return 0;
+        c = QChar::surrogateToUcs4( text[pos], text[pos+1] );
+        size = 2;
+    }
+
+    return IsTokenChar( c, inToken ) ? size : 0;
+} /* TokenCharAt */
+
+
+TextAnalyzer::TextAnalyzer(StemFunction stemFunction)
+    : stemFunction( stemFunction ), tokenCount( 0 )
+{
+}
+
+
+/*FN**************************************************************************
+
+       analyze( text, length )
+
+   Returns: int -- the number of tokens found
+
+   Purpose: Find every token of the text and stem it as soon as it ends,
+            while its characters are still in cache.
+
+   Plan:    The arena is sized to the text up front: the stems together
+            are never longer than the tokens, so the copy of each token
+            goes straight to the end of the arena and is stemmed in
+            place there.  Records grow by doubling and only ever grow.
+**/
+
+int TextAnalyzer::analyze(const QChar *text, int length)
+{
+    int used = 0;
+    int pos = 0;
+    int size;
+
+    tokenCount = 0;
+    if(arena.size() < length)
+        arena.resize( length );
+    QChar *stems = arena.data();
+
+    while(pos < length)
+    {
+        while(pos < length && 0 == (size = TokenCharAt( text, length, pos, false )))
+            pos++;
+        if(pos >= length)
+            break;
+
+        int start = pos;
+        do
+            pos += size;
+        while(pos < length && 0 != (size = TokenCharAt( text, length, pos, true )));
+
+        if(tokenCount == records.size())
+            records.resize( qMax( 64, 2 * records.size() ) );
+
+        AnalyzedToken &token = records[tokenCount++];
+        token.start = start;
+        token.length = pos - start;
+        token.stem = used;
+        memcpy( stems + used, text + start, token.length * sizeof(QChar) );
+        token.stemLength = stemFunction( stems + used, token.length );
+        used += token.stemLength;
+    }
+
+    return tokenCount;
+} /* analyze */
+
+QString TextAnalyzer::stem(int i) const
+{
+    const AnalyzedToken &t = records.at(i);
+    return QString( arena.constData() + t.stem, t.stemLength );
+}
@@ -0,0 +1,56 @@
+/******************************************************************
+
+   Fused tokenizer and stemmer: one pass over a UTF-16 text buffer
+   yields every letter run with its position and its stem.
+
+   Licensed under GPLv3. See LICENCE.md file
+
+**/
+
+#ifndef TEXTANALYZER_H
+#define TEXTANALYZER_H
+
+#include <QString>
+#include <QVector>
+
+typedef struct {
+           int start;              /* offset of the token in the text */
+           int length;             /* characters of the token in the text */
+           int stem;               /* offset of the stem in the arena */
+           int stemLength;
+           } AnalyzedToken;
+
+class TextAnalyzer
+{
+public:
+    // Stems word[0..length) in place and returns the stem length, which
+    // must not be longer than the word; the stem(QChar *, int) overloads
+    // of both stemmers fit.
+    typedef int (*StemFunction)(QChar *word, int length);
+
+    explicit TextAnalyzer(StemFunction stemFunction);
+
+    // Tokenizes and stems text[0..length), replacing the results of the
+    // previous call, and returns the number of tokens. Offsets are in
+    // UTF-16 code units, as QString positions are. The token and stem
+    // storage is kept between calls, so analysing text no larger than
+    // before allocates nothing.
+    int analyze(const QChar *text, int length);
+    int analyze(const QString &text) { return analyze( text.constData(), text.length() ); }
+
+    int count() const { return tokenCount; }
+    const AnalyzedToken *tokens() const { return records.constData(); }
+    const AnalyzedToken &token(int i) const { return records.at(i); }
+
+    // The stem of a token, valid until the next analyze().
+    const QChar *stemChars(const AnalyzedToken &token) const { return arena.constData() + token.stem; }
+    QString stem(int i) const;
+
+private:
+    StemFunction stemFunction;
+    QVector<AnalyzedToken> records;    /* the first tokenCount are valid */
+    QVector<QChar> arena;              /* stems back to back */
+    int tokenCount;
+};
+
+#endif // TEXTANALYZER_H
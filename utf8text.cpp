@@ -0,0 +1,223 @@
+/******************************************************************
+
+   Minimal UTF-8 <-> UTF-16 conversion into caller buffers and a letter
+   run tokenizer, used by the byte oriented front ends so tokens never
+   become QStrings.
+
+   Licensed under GPLv3. See LICENCE.md file
+
+**/
+
+#include "utf8text.h"
+
+/*FN**************************************************************************
+
+       Utf8ToUtf16( in, length, out )
+
+   Returns: int -- the number of UTF-16 units written to out
+
+   Purpose: Decode in[0..length).  out needs room for length units, a
+            UTF-8 sequence never decodes to more units than it has bytes.
+
+   Notes:   Malformed or truncated sequences decode to U+FFFD, one per
+            offending byte, like QString::fromUtf8() does.
+**/
+
+int Utf8ToUtf16(const char *in, int length, QChar *out)
+{
+    const uchar *p = reinterpret_cast<const uchar *>( in );
+    const uchar *end = p + length;
+    int count = 0;
+
+    while ( p < end )
+    {
+        uint c = *p++;
+        int extra;
+        uint min;
+
+        if ( c < 0x80 )
+        {
+            out[count++] = QChar( (ushort)c );
+            continue;
+        }
+        else if ( 0xC0 == (c & 0xE0) ) { extra = 1; min = 0x80; c &= 0x1F; }
+        else if ( 0xE0 == (c & 0xF0) ) { extra = 2; min = 0x800; c &= 0x0F; }
+        else if ( 0xF0 == (c & 0xF8) ) { extra = 3; min = 0x10000; c &= 0x07; }
+        else
+        {
+            out[count++] = QChar( (ushort)0xFFFD );
+            continue;
+        }
+
+        const uchar *start = p;
+        while ( extra > 0 && p < end && 0x80 == (*p & 0xC0) )
+        {
+            c = (c << 6) | (*p++ & 0x3F);
+            extra--;
+        }
+
+        if ( extra > 0 || c < min || c > 0x10FFFF || (c >= 0xD800 && c < 0xE000) )
+        {
+            p = start;
+            out[count++] = QChar( (ushort)0xFFFD );
+        }
+        else if ( c >= 0x10000 )
+        {
+            out[count++] = QChar( (ushort)(0xD800 + ((c - 0x10000) >> 10)) );
+            out[count++] = QChar( (ushort)(0xDC00 + ((c - 0x10000) & 0x3FF)) );
+        }
+        else
+            out[count++] = QChar( (ushort)c );
+    }
+
+    return count;
+} /* Utf8ToUtf16 */
+
+
+/*FN**************************************************************************
+
+       Utf16ToUtf8( in, length, out )
+
+   Returns: int -- the number of bytes written to out
+
+   Purpose: Encode in[0..length).  out needs room for 3 * length bytes.
+
+   Notes:   Unpaired surrogates are encoded as U+FFFD.
+**/
+
+int Utf16ToUtf8(const QChar *in, int length, char *out)
+{
+    int count = 0;
+
+    for(int i=0; i<length; i++)
+    {
+        uint c = in[i].unicode();
+
+        if ( c >= 0xD800 && c < 0xDC00 && i + 1 < length
+             && in[i+1].unicode() >= 0xDC00 && in[i+1].unicode() < 0xE000 )
+        {
+            c = 0x10000 + ((c - 0xD800) << 10) + (in[++i].unicode() - 0xDC00);
+        }
+        else if ( c >= 0xD800 && c < 0xE000 )
+            c = 0xFFFD;
+
+        if ( c < 0x80 )
+            out[count++] = (char)c;
+        else if ( c < 0x800 )
+        {
+            out[count++] = (char)(0xC0 | (c >> 6));
+            out[count++] = (char)(0x80 | (c & 0x3F));
+        }
+        else if ( c < 0x10000 )
+        {
+            out[count++] = (char)(0xE0 | (c >> 12));
+            out[count++] = (char)(0x80 | ((c >> 6) & 0x3F));
+            out[count++] = (char)(0x80 | (c & 0x3F));
+        }
+        else
+        {
+            out[count++] = (char)(0xF0 | (c >> 18));
+            out[count++] = (char)(0x80 | ((c >> 12) & 0x3F));
+            out[count++] = (char)(0x80 | ((c >> 6) & 0x3F));
+            out[count++] = (char)(0x80 | (c & 0x3F));
+        }
+    }
+
+    return count;
+} /* Utf16ToUtf8 */
+
+
+/*FN**************************************************************************
+
+       LetterAt( text, length, pos, inToken )
+
+   Returns: int -- the byte length of the character at pos if it belongs
+            to a token, 0 if it does not
+
+   Notes:   ASCII is checked inline, anything else is decoded and asked
+            IsTokenChar(), so Latvian and other accented letters stay
+            inside tokens.  Malformed bytes are separators.
+**/
+
+static int LetterAt(const char *text, qint64 length, qint64 pos, bool inToken)
+{
+    uint c = uchar(text[pos]);
+
+    if ( c < 0x80 )
+        return IsTokenChar( c, inToken ) ? 1 : 0;
+
+    int extra;
+    if ( 0xC0 == (c & 0xE0) ) { extra = 1; c &= 0x1F; }
+    else if ( 0xE0 == (c & 0xF0) ) { extra = 2; c &= 0x0F; }
+    else if ( 0xF0 == (c & 0xF8) ) { extra = 3; c &= 0x07; }
+    else
+        return 0;
+
+    if ( pos + extra >= length )
+        return 0;
+
+    for(int i=1; i<=extra; i++)
+    {
+        uchar b = uchar(text[pos + i]);
+        if ( 0x80 != (b & 0xC0) )
+            return 0;
+        c = (c << 6) | (b & 0x3F);
+    }
+
+    return IsTokenChar( c, inToken ) ? extra + 1 : 0;
+} /* LetterAt */
+
+
+/*FN**************************************************************************
+
+       Utf8NextToken( text, length, pos, start )
+
+   Returns: bool -- false when there are no more tokens
+
+   Purpose: Find the next token in text at or after *pos: a letter and
+            the letters and combining marks after it.  On success the
+            token is text[*start..*pos).
+**/
+
+bool Utf8NextToken(const char *text, qint64 length, qint64 *pos, qint64 *start)
+{
+    qint64 p = *pos;
+    int size;
+
+    while ( p < length && 0 == (size = LetterAt( text, length, p, false )) )
+        p++;
+
+    if ( p >= length )
+    {
+        *pos = length;
+        return false;
+    }
+
+    *start = p;
+    do
+        p += size;
+    while ( p < length && 0 != (size = LetterAt( text, length, p, true )) );
+
+    *pos = p;
+    return true;
+} /* Utf8NextToken */
+
+
+/*FN**************************************************************************
+
+       Utf8TokenBoundary( text, length, pos )
+
+   Returns: qint64 -- the first position at or after pos where text can be
+            cut without splitting a token
+
+   Notes:   Any ASCII byte that is not a letter separates tokens, and
+            ASCII bytes never occur inside a multi-byte sequence.
+**/
+
+qint64 Utf8TokenBoundary(const char *text, qint64 length, qint64 pos)
+{
+    while ( pos < length && ( uchar(text[pos]) >= 0x80 || 1 == LetterAt( text, length, pos, true ) ) )
+        pos++;
+
+    return pos;
+} /* Utf8TokenBoundary */
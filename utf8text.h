@@ -0,0 +1,34 @@
+/******************************************************************
+
+   Minimal UTF-8 <-> UTF-16 conversion into caller buffers and a letter
+   run tokenizer, used by the byte oriented front ends so tokens never
+   become QStrings.
+
+   Licensed under GPLv3. See LICENCE.md file
+
+**/
+
+#ifndef UTF8TEXT_H
+#define UTF8TEXT_H
+
+#include <QChar>
+
+// True if the code point c belongs to a token. Letters start and
+// continue one, combining marks only continue one, so a letter written
+// with a combining macron or caron stays one word. Both tokenizers,
+// this one and TextAnalyzer, classify through it.
+inline bool IsTokenChar(uint c, bool inToken)
+{
+    if ( c < 0x80 )
+        return ('a' <= c && c <= 'z') || ('A' <= c && c <= 'Z');
+
+    return QChar::isLetter( c ) || (inToken && QChar::isMark( c ));
+}
+
+int Utf8ToUtf16(const char *in, int length, QChar *out);
+int Utf16ToUtf8(const QChar *in, int length, char *out);
+
+bool Utf8NextToken(const char *text, qint64 length, qint64 *pos, qint64 *start);
+qint64 Utf8TokenBoundary(const char *text, qint64 length, qint64 pos);
+
+#endif // UTF8TEXT_H
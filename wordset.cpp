@@ -0,0 +1,98 @@
+/******************************************************************
+
+   Open addressing hash set of words that can be probed with a raw
+   QChar buffer, so a lookup never builds a QString.  The set points
+   into the words' own static text instead of copying it.
+
+   Licensed under GPLv3. See LICENCE.md file
+
+**/
+
+#include "wordset.h"
+
+#include <string.h>
+
+WordSet::WordSet() :
+    count(0)
+{
+    rehash( 16 );
+}
+
+/* FNV-1a over the UTF-16 code units */
+uint WordSet::hash(const QChar *word, int length)
+{
+    uint h = 2166136261u;
+    for(int i=0; i<length; i++)
+    {
+        h ^= word[i].unicode();
+        h *= 16777619u;
+    }
+    return h;
+}
+
+void WordSet::rehash(int capacity)
+{
+    QVector<RuleText> old = slots;
+    RuleText free = { NULL, 0 };
+
+    slots = QVector<RuleText>( capacity, free );
+    count = 0;
+    for(int i=0; i<old.size(); i++)
+    {
+        if(old.at(i).length > 0)
+            insert( old.at(i) );
+    }
+}
+
+/*FN**************************************************************************
+
+       insert( word )
+
+   Purpose: Add word to the set.  Empty words are ignored, they are used
+            to mark free slots.
+
+   Plan:    Linear probing, the table is kept at most half full.
+**/
+
+void WordSet::insert(const RuleText &word)
+{
+    if(0 == word.length || contains( RuleChars( word ), word.length ))
+        return;
+
+    if(2 * (count + 1) > slots.size())
+        rehash( 2 * slots.size() );
+
+    int mask = slots.size() - 1;
+    int i = hash( RuleChars( word ), word.length ) & mask;
+    while(slots.at(i).length > 0)
+        i = (i + 1) & mask;
+
+    slots[i] = word;
+    count++;
+} /* insert */
+
+
+/*FN**************************************************************************
+
+       contains( word, length )
+
+   Returns: bool -- true if word[0..length) is in the set
+**/
+
+bool WordSet::contains(const QChar *word, int length) const
+{
+    if(0 == length)
+        return false;
+
+    int mask = slots.size() - 1;
+    int i = hash( word, length ) & mask;
+    for(;;)
+    {
+        const RuleText &slot = slots.at(i);
+        if(0 == slot.length)
+            return false;
+        if(slot.length == length && 0 == memcmp( slot.text, word, length * sizeof(QChar) ))
+            return true;
+        i = (i + 1) & mask;
+    }
+} /* contains */
@@ -0,0 +1,36 @@
+/******************************************************************
+
+   Open addressing hash set of words that can be probed with a raw
+   QChar buffer, so a lookup never builds a QString.  The set points
+   into the words' own static text instead of copying it.
+
+   Licensed under GPLv3. See LICENCE.md file
+
+**/
+
+#ifndef WORDSET_H
+#define WORDSET_H
+
+#include <QVector>
+
+#include "ruletext.h"
+
+class WordSet
+{
+public:
+    WordSet();
+
+    // word is not copied, its text must outlive the set.
+    void insert(const RuleText &word);
+    bool contains(const QChar *word, int length) const;
+    int size() const { return count; }
+
+private:
+    static uint hash(const QChar *word, int length);
+    void rehash(int capacity);
+
+    QVector<RuleText> slots;      /* length 0 marks a free slot */
+    int count;
+};
+
+#endif // WORDSET_H